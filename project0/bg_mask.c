@@ -0,0 +1,78 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "bg_mask.h"
+
+#if !USE_RLE_BACKGROUND
+
+/********************************************************************************/
+// Global Variables
+/********************************************************************************/
+typedef struct {
+    uint16_t x, y, width, height;
+    uint32_t color;
+} bg_region_t;
+
+static uint8_t mask[BG_MASK_HEIGHT][BG_MASK_WIDTH / 8];    // 29 KB
+static bg_region_t regions[BG_MAX_REGIONS];
+static uint32_t num_regions = 0;
+static uint32_t fill_color = 0;     // pixels without mask bit
+static uint32_t stroke_color = 0;   // mask bits outside of all regions
+
+/********************************************************************************/
+void bg_mask_init(uint32_t fill, uint32_t stroke){
+    memset(mask, 0, sizeof(mask));
+    num_regions = 0;
+    fill_color = fill;
+    stroke_color = stroke;
+}
+
+void bg_mask_set(uint32_t x, uint32_t y){
+    // unsigned wrap-around clips left/top as well
+    x -= BG_MASK_X;
+    y -= BG_MASK_Y;
+    if (x >= BG_MASK_WIDTH || y >= BG_MASK_HEIGHT) return;
+    mask[y][x >> 3] |= 0x80 >> (x & 7);
+}
+
+bool bg_mask_add_region(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t color){
+    if (color == stroke_color) return true;         // default color needs no entry
+
+    // glyph cells of one text line grow the previous region instead of taking a new one
+    if (num_regions > 0) {
+        bg_region_t *last = &regions[num_regions - 1];
+        if (last->color == color && last->y == y && last->height == height &&
+            x >= last->x && x <= (uint32_t)last->x + last->width + 1) {
+            if (x + width > (uint32_t)last->x + last->width) last->width = x + width - last->x;
+            return true;
+        }
+    }
+    if (num_regions >= BG_MAX_REGIONS) return false;
+    regions[num_regions].x = x;
+    regions[num_regions].y = y;
+    regions[num_regions].width = width;
+    regions[num_regions].height = height;
+    regions[num_regions].color = color;
+    num_regions++;
+    return true;
+}
+
+uint32_t bg_color(uint32_t x, uint32_t y){
+    uint32_t mx = x - BG_MASK_X;
+    uint32_t my = y - BG_MASK_Y;
+    uint32_t i;
+
+    if (mx >= BG_MASK_WIDTH || my >= BG_MASK_HEIGHT) return fill_color;
+    if (!(mask[my][mx >> 3] & (0x80 >> (mx & 7)))) return fill_color;
+
+    // static pixel: color lookup
+    for (i = 0; i < num_regions; i++) {
+        const bg_region_t *r = &regions[i];
+        if (x >= r->x && x < (uint32_t)r->x + r->width && y >= r->y && y < (uint32_t)r->y + r->height)
+            return r->color;
+    }
+    return stroke_color;
+}
+
+#endif
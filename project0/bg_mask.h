@@ -0,0 +1,33 @@
+#ifndef BG_MASK_H_
+#define BG_MASK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Compact description of the static gauge background (arc, ticks, labels):
+// one bit per pixel says "static pixel here", its color comes from a small
+// region table (e.g. label cells) or the default stroke color.
+// Used to restore pixels under the moving needle instead of painting BLACK.
+// With USE_RLE_BACKGROUND the dial image in flash does that, and the mask (29 KB of
+// SRAM) is not built at all.
+
+#ifndef USE_RLE_BACKGROUND
+#define USE_RLE_BACKGROUND 1
+#endif
+
+// Covered area: needle sweep around (400,280) with r = 245, plus margin for thicker needles
+#define BG_MASK_X 144
+#define BG_MASK_Y 24
+#define BG_MASK_WIDTH 512
+#define BG_MASK_HEIGHT 456
+#define BG_MAX_REGIONS 24
+
+#if !USE_RLE_BACKGROUND
+
+void bg_mask_init(uint32_t fill, uint32_t stroke);     // clears mask and regions
+void bg_mask_set(uint32_t x, uint32_t y);
+bool bg_mask_add_region(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t color);
+uint32_t bg_color(uint32_t x, uint32_t y);              // background color of a pixel
+#endif
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef CYCLES_H_
+#define CYCLES_H_
+
+#include <stdint.h>
+
+// Cycle counter for timing measurements: DWT CYCCNT on the Cortex-M4
+// (120 MHz => 120 cycles per us), nanoseconds in a HOST_BUILD.
+
+#ifdef HOST_BUILD
+
+#include <time.h>
+
+static inline void cycles_init(void){}
+
+static inline uint32_t cycles_now(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ull + ts.tv_nsec);
+}
+
+#else
+
+#include "inc/hw_types.h"
+
+#define DEMCR 0xE000EDFC        // Debug Exception and Monitor Control
+#define DEMCR_TRCENA 0x01000000 // enables DWT
+#define DWT_CTRL 0xE0001000
+#define DWT_CTRL_CYCCNTENA 0x00000001
+#define DWT_CYCCNT 0xE0001004
+
+static inline void cycles_init(void){
+    HWREG(DEMCR) |= DEMCR_TRCENA;
+    HWREG(DWT_CYCCNT) = 0;
+    HWREG(DWT_CTRL) |= DWT_CTRL_CYCCNTENA;
+}
+
+static inline uint32_t cycles_now(void){
+    return HWREG(DWT_CYCCNT);
+}
+
+#endif
+
+#endif
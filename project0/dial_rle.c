@@ -0,0 +1,366 @@
+// Generated by host/gen_dial.c (make -C project0/host dial), do not edit
+#include "dial_rle.h"
+
+const uint16_t dial_rle[DIAL_RLE_RUNS] = {
+    0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x0C00, 0x010E, 0x0BF8, 0x0BA0, 0x01CE,
+    0x0B98, 0x0B60, 0x024E, 0x0B58, 0x0B28, 0x02BE, 0x0B20, 0x0AF8, 0x010E, 0x0080, 0x000E, 0x0080,
+    0x010E, 0x0AF0, 0x0AD0, 0x00D6, 0x00E0, 0x000E, 0x00E0, 0x00D6, 0x0AC8, 0x0AA8, 0x00BE, 0x0020,
+    0x000E, 0x00F8, 0x000E, 0x00F0, 0x000E, 0x0028, 0x00BE, 0x0AA0, 0x0A88, 0x00A6, 0x0058, 0x000E,
+    0x00F8, 0x000E, 0x00F0, 0x000E, 0x0060, 0x00A6, 0x0A80, 0x0A68, 0x0096, 0x0088, 0x000E, 0x00F8,
+    0x000E, 0x00F0, 0x000E, 0x0090, 0x0096, 0x0A60, 0x0A48, 0x008E, 0x00B0, 0x000E, 0x00F8, 0x000E,
+    0x00F0, 0x000E, 0x00B8, 0x008E, 0x0A40, 0x0A28, 0x008E, 0x01D0, 0x000E, 0x01D0, 0x008E, 0x0A20,
+    0x0A10, 0x007E, 0x01F8, 0x000E, 0x01F0, 0x0086, 0x0A08, 0x09F8, 0x0076, 0x0020, 0x000E, 0x01F0,
+    0x000E, 0x01E8, 0x000E, 0x0028, 0x0076, 0x09F0, 0x09E0, 0x0076, 0x0038, 0x000E, 0x01F0, 0x000E,
+    0x01E8, 0x000E, 0x0040, 0x0076, 0x09D8, 0x09C8, 0x006E, 0x0060, 0x000E, 0x01E8, 0x000E, 0x01E0,
+    0x000E, 0x0068, 0x006E, 0x09C0, 0x09B0, 0x006E, 0x0078, 0x000E, 0x01E8, 0x000E, 0x01E0, 0x000E,
+    0x0080, 0x006E, 0x09A8, 0x0998, 0x0066, 0x0288, 0x000E, 0x0288, 0x0066, 0x0990, 0x0980, 0x0066,
+    0x02A0, 0x000E, 0x02A0, 0x0066, 0x0978, 0x0970, 0x005E, 0x02B8, 0x000E, 0x02B8, 0x005E, 0x0968,
+    0x0958, 0x005E, 0x05A8, 0x005E, 0x0950, 0x0948, 0x005E, 0x05C8, 0x005E, 0x0940, 0x0930, 0x005E,
+    0x0010, 0x000E, 0x05C0, 0x000E, 0x0018, 0x005E, 0x0928, 0x0920, 0x0056, 0x0028, 0x000E, 0x05C0,
+    0x000E, 0x0030, 0x0056, 0x0918, 0x0910, 0x0056, 0x0040, 0x000E, 0x05B0, 0x000E, 0x0048, 0x0056,
+    0x0908, 0x08F8, 0x0056, 0x0058, 0x000E, 0x05B0, 0x000E, 0x0060, 0x0056, 0x08F0, 0x08E8, 0x0056,
+    0x0698, 0x0056, 0x08E0, 0x08D8, 0x0056, 0x06B8, 0x0056, 0x08D0, 0x08C8, 0x004E, 0x06E8, 0x004E,
+    0x08C0, 0x08B8, 0x004E, 0x0708, 0x004E, 0x08B0, 0x08A8, 0x004E, 0x0728, 0x004E, 0x08A0, 0x0898,
+    0x004E, 0x0748, 0x004E, 0x0890, 0x0888, 0x004E, 0x0768, 0x004E, 0x0880, 0x0878, 0x004E, 0x0788,
+    0x004E, 0x0870, 0x0868, 0x004E, 0x07A0, 0x0056, 0x0860, 0x0860, 0x0046, 0x0010, 0x000E, 0x0790,
+    0x000E, 0x0018, 0x0046, 0x0858, 0x0850, 0x0046, 0x0020, 0x000E, 0x0790, 0x000E, 0x0028, 0x0046,
+    0x0848, 0x0840, 0x0046, 0x0038, 0x000E, 0x0780, 0x000E, 0x0040, 0x0046, 0x0838, 0x0830, 0x0046,
+    0x0828, 0x0046, 0x0828, 0x0828, 0x0046, 0x0838, 0x0046, 0x0820, 0x0818, 0x0046, 0x0858, 0x0046,
+    0x0810, 0x0808, 0x0046, 0x0878, 0x0046, 0x0800, 0x0800, 0x003E, 0x0898, 0x003E, 0x07F8, 0x07F0,
+    0x0046, 0x08A8, 0x0046, 0x07E8, 0x07E8, 0x003E, 0x08C8, 0x003E, 0x07E0, 0x07D8, 0x003E, 0x08E8,
+    0x003E, 0x07D0, 0x07C8, 0x0046, 0x08F8, 0x0046, 0x07C0, 0x07C0, 0x003E, 0x0458, 0x0021, 0x0028,
+    0x0021, 0x0028, 0x0021, 0x0410, 0x003E, 0x07B8, 0x07B0, 0x0046, 0x0458, 0x0031, 0x0018, 0x0031,
+    0x0018, 0x0031, 0x0410, 0x0046, 0x07A8, 0x07A8, 0x003E, 0x0460, 0x0011, 0x0018, 0x0019, 0x0008,
+    0x0019, 0x0010, 0x0019, 0x0008, 0x0019, 0x0010, 0x0019, 0x0418, 0x003E, 0x07A0, 0x07A0, 0x003E,
+    0x0490, 0x0011, 0x0010, 0x0011, 0x0020, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0418, 0x0046,
+    0x0798, 0x0790, 0x003E, 0x0008, 0x000E, 0x0488, 0x0019, 0x0010, 0x0011, 0x0020, 0x0011, 0x0008,
+    0x0011, 0x0020, 0x0011, 0x0418, 0x000E, 0x0010, 0x003E, 0x0788, 0x0788, 0x003E, 0x0018, 0x000E,
+    0x0478, 0x0019, 0x0018, 0x0011, 0x0020, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0410, 0x000E,
+    0x0020, 0x003E, 0x0780, 0x0778, 0x003E, 0x0030, 0x000E, 0x0468, 0x0019, 0x0020, 0x0011, 0x0020,
+    0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0408, 0x000E, 0x0038, 0x003E, 0x0770, 0x0770, 0x003E,
+    0x0040, 0x000E, 0x0458, 0x0019, 0x0028, 0x0011, 0x0020, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011,
+    0x0400, 0x000E, 0x0048, 0x003E, 0x0768, 0x0768, 0x0036, 0x0050, 0x000E, 0x0450, 0x0019, 0x0030,
+    0x0019, 0x0010, 0x0019, 0x0008, 0x0019, 0x0010, 0x0019, 0x0400, 0x000E, 0x0058, 0x0036, 0x0760,
+    0x0758, 0x003E, 0x0060, 0x000E, 0x0448, 0x0041, 0x0010, 0x0031, 0x0018, 0x0031, 0x0400, 0x000E,
+    0x0068, 0x003E, 0x0750, 0x0750, 0x003E, 0x0070, 0x000E, 0x0440, 0x0041, 0x0018, 0x0021, 0x0028,
+    0x0021, 0x0400, 0x000E, 0x0078, 0x003E, 0x0748, 0x0748, 0x0036, 0x0088, 0x000E, 0x08F0, 0x000E,
+    0x0090, 0x0036, 0x0740, 0x0738, 0x003E, 0x0090, 0x000E, 0x08F0, 0x000E, 0x0098, 0x003E, 0x0730,
+    0x0730, 0x003E, 0x00A0, 0x000E, 0x08E0, 0x000E, 0x00A8, 0x003E, 0x0728, 0x0728, 0x0036, 0x00B8,
+    0x000E, 0x08D0, 0x000E, 0x00C0, 0x0036, 0x0720, 0x0720, 0x0036, 0x0A68, 0x0036, 0x0718, 0x0710,
+    0x003E, 0x0A78, 0x003E, 0x0708, 0x0708, 0x003E, 0x0A88, 0x003E, 0x0700, 0x0700, 0x0036, 0x0AA8,
+    0x0036, 0x06F8, 0x06F8, 0x0036, 0x0AB8, 0x0036, 0x06F0, 0x06F0, 0x0036, 0x0AC8, 0x0036, 0x06E8,
+    0x06E8, 0x0036, 0x0AD8, 0x0036, 0x06E0, 0x06D8, 0x003E, 0x0AE0, 0x0046, 0x06D0, 0x06D0, 0x0036,
+    0x0008, 0x000E, 0x0AE0, 0x000E, 0x0010, 0x0036, 0x06C8, 0x06C8, 0x0036, 0x0018, 0x000E, 0x0AD0,
+    0x000E, 0x0020, 0x0036, 0x06C0, 0x06C0, 0x0036, 0x0028, 0x000E, 0x0AC0, 0x000E, 0x0030, 0x0036,
+    0x06B8, 0x06B8, 0x0036, 0x0B38, 0x0036, 0x06B0, 0x06B0, 0x0036, 0x0B48, 0x0036, 0x06A8, 0x06A8,
+    0x0036, 0x0B58, 0x0036, 0x06A0, 0x06A0, 0x0036, 0x0B68, 0x0036, 0x0698, 0x0698, 0x0036, 0x0B78,
+    0x0036, 0x0690, 0x0690, 0x0036, 0x0B88, 0x0036, 0x0688, 0x0688, 0x002E, 0x0BA8, 0x002E, 0x0680,
+    0x0680, 0x002E, 0x0BB8, 0x002E, 0x0678, 0x0678, 0x002E, 0x0BC8, 0x002E, 0x0670, 0x0670, 0x002E,
+    0x0BD8, 0x002E, 0x0668, 0x0668, 0x002E, 0x0BE8, 0x002E, 0x0660, 0x0660, 0x002E, 0x0BF8, 0x002E,
+    0x0658, 0x0658, 0x002E, 0x01D8, 0x0011, 0x0020, 0x0039, 0x0020, 0x0021, 0x0748, 0x0021, 0x0018,
+    0x0039, 0x0020, 0x0021, 0x0190, 0x002E, 0x0650, 0x0650, 0x002E, 0x01D8, 0x0019, 0x0020, 0x0039,
+    0x0018, 0x0031, 0x0738, 0x0031, 0x0010, 0x0039, 0x0018, 0x0031, 0x0190, 0x002E, 0x0648, 0x0648,
+    0x002E, 0x01D8, 0x0021, 0x0020, 0x0011, 0x0038, 0x0019, 0x0010, 0x0019, 0x0728, 0x0011, 0x0018,
+    0x0019, 0x0008, 0x0011, 0x0038, 0x0019, 0x0010, 0x0019, 0x0190, 0x002E, 0x0640, 0x0640, 0x002E,
+    0x01F0, 0x0011, 0x0020, 0x0011, 0x0038, 0x0011, 0x0020, 0x0011, 0x0750, 0x0011, 0x0010, 0x0011,
+    0x0038, 0x0011, 0x0020, 0x0011, 0x0198, 0x002E, 0x0638, 0x0638, 0x0036, 0x01F0, 0x0011, 0x0020,
+    0x0031, 0x0018, 0x0011, 0x0020, 0x0011, 0x0748, 0x0019, 0x0010, 0x0031, 0x0018, 0x0011, 0x0020,
+    0x0011, 0x0198, 0x0036, 0x0630, 0x0630, 0x0036, 0x01F8, 0x0011, 0x0020, 0x0039, 0x0010, 0x0011,
+    0x0020, 0x0011, 0x0740, 0x0019, 0x0018, 0x0039, 0x0010, 0x0011, 0x0020, 0x0011, 0x01A0, 0x0036,
+    0x0628, 0x0628, 0x0036, 0x0200, 0x0011, 0x0048, 0x0019, 0x0008, 0x0011, 0x0020, 0x0011, 0x0738,
+    0x0019, 0x0048, 0x0019, 0x0008, 0x0011, 0x0020, 0x0011, 0x01A0, 0x003E, 0x0620, 0x0620, 0x0036,
+    0x0008, 0x000E, 0x01F8, 0x0011, 0x0050, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0730, 0x0019,
+    0x0058, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0198, 0x000E, 0x0010, 0x0036, 0x0618, 0x0618,
+    0x0036, 0x0018, 0x000E, 0x01F0, 0x0011, 0x0020, 0x0011, 0x0020, 0x0011, 0x0008, 0x0019, 0x0010,
+    0x0019, 0x0728, 0x0019, 0x0030, 0x0011, 0x0020, 0x0011, 0x0008, 0x0019, 0x0010, 0x0019, 0x0190,
+    0x000E, 0x0020, 0x0036, 0x0610, 0x0618, 0x002E, 0x0028, 0x000E, 0x01D8, 0x0031, 0x0010, 0x0039,
+    0x0018, 0x0031, 0x0730, 0x0041, 0x0008, 0x0039, 0x0018, 0x0031, 0x0190, 0x000E, 0x0030, 0x002E,
+    0x0610, 0x0610, 0x002E, 0x0210, 0x0031, 0x0018, 0x0029, 0x0028, 0x0021, 0x0738, 0x0041, 0x0010,
+    0x0029, 0x0028, 0x0021, 0x01D8, 0x002E, 0x0608, 0x0608, 0x002E, 0x0CA8, 0x002E, 0x0600, 0x0600,
+    0x002E, 0x0CB8, 0x002E, 0x05F8, 0x05F8, 0x002E, 0x0CC8, 0x002E, 0x05F0, 0x05F0, 0x0036, 0x0CC8,
+    0x0036, 0x05E8, 0x05E8, 0x0036, 0x0CD8, 0x0036, 0x05E0, 0x05E8, 0x002E, 0x0CE8, 0x002E, 0x05E0,
+    0x05E0, 0x002E, 0x0CF8, 0x002E, 0x05D8, 0x05D8, 0x002E, 0x0D08, 0x002E, 0x05D0, 0x05D0, 0x002E,
+    0x0D18, 0x002E, 0x05C8, 0x05C8, 0x0036, 0x0D18, 0x0036, 0x05C0, 0x05C8, 0x002E, 0x0D28, 0x002E,
+    0x05C0, 0x05C0, 0x002E, 0x0D38, 0x002E, 0x05B8, 0x05B8, 0x002E, 0x0D48, 0x002E, 0x05B0, 0x05B0,
+    0x002E, 0x0D58, 0x002E, 0x05A8, 0x05B0, 0x002E, 0x0D58, 0x002E, 0x05A8, 0x05A8, 0x002E, 0x0D68,
+    0x002E, 0x05A0, 0x05A0, 0x002E, 0x0D78, 0x002E, 0x0598, 0x0598, 0x002E, 0x0D88, 0x002E, 0x0590,
+    0x0598, 0x002E, 0x0D88, 0x002E, 0x0590, 0x0590, 0x002E, 0x0D98, 0x002E, 0x0588, 0x0588, 0x003E,
+    0x0D80, 0x0016, 0x0008, 0x002E, 0x0580, 0x0588, 0x0026, 0x0018, 0x000E, 0x0D70, 0x000E, 0x0020,
+    0x0026, 0x0580, 0x0580, 0x002E, 0x0020, 0x000E, 0x0D60, 0x000E, 0x0028, 0x002E, 0x0578, 0x0578,
+    0x002E, 0x0DC8, 0x002E, 0x0570, 0x0570, 0x002E, 0x0DD8, 0x002E, 0x0568, 0x0570, 0x002E, 0x0DD8,
+    0x002E, 0x0568, 0x0568, 0x002E, 0x0DE8, 0x002E, 0x0560, 0x0560, 0x002E, 0x0DF8, 0x002E, 0x0558,
+    0x0560, 0x002E, 0x0DF8, 0x002E, 0x0558, 0x0558, 0x002E, 0x0E08, 0x002E, 0x0550, 0x0558, 0x0026,
+    0x0E18, 0x0026, 0x0550, 0x0550, 0x002E, 0x0E18, 0x002E, 0x0548, 0x0548, 0x002E, 0x0E28, 0x002E,
+    0x0540, 0x0548, 0x0026, 0x0E38, 0x0026, 0x0540, 0x0540, 0x002E, 0x0E38, 0x002E, 0x0538, 0x0538,
+    0x002E, 0x0E48, 0x002E, 0x0530, 0x0538, 0x0026, 0x0E58, 0x0026, 0x0530, 0x0530, 0x002E, 0x0E58,
+    0x002E, 0x0528, 0x0530, 0x0026, 0x0E68, 0x0026, 0x0528, 0x0528, 0x002E, 0x0E68, 0x002E, 0x0520,
+    0x0520, 0x002E, 0x0E78, 0x002E, 0x0518, 0x0520, 0x0026, 0x0E88, 0x0026, 0x0518, 0x0518, 0x002E,
+    0x0E88, 0x002E, 0x0510, 0x0518, 0x0026, 0x06B8, 0x0009, 0x0030, 0x0009, 0x0008, 0x0009, 0x0030,
+    0x0009, 0x0050, 0x0009, 0x0030, 0x0009, 0x06C8, 0x0026, 0x0510, 0x0510, 0x002E, 0x06B8, 0x0009,
+    0x0028, 0x0009, 0x0010, 0x0011, 0x0020, 0x0011, 0x0040, 0x0009, 0x0008, 0x0009, 0x0030, 0x0009,
+    0x06C8, 0x002E, 0x0508, 0x0510, 0x0026, 0x06C0, 0x0009, 0x0020, 0x0009, 0x0018, 0x0009, 0x0008,
+    0x0009, 0x0010, 0x0009, 0x0008, 0x0009, 0x0038, 0x0009, 0x0010, 0x0009, 0x0030, 0x0009, 0x06D0,
+    0x0026, 0x0508, 0x0508, 0x002E, 0x06C0, 0x0009, 0x0018, 0x0009, 0x0020, 0x0009, 0x0010, 0x0011,
+    0x0010, 0x0009, 0x0030, 0x0009, 0x0018, 0x0009, 0x0030, 0x0009, 0x06C8, 0x0036, 0x0500, 0x0500,
+    0x002E, 0x0008, 0x0016, 0x06B0, 0x0009, 0x0010, 0x0009, 0x0028, 0x0009, 0x0018, 0x0009, 0x0010,
+    0x0009, 0x0028, 0x0009, 0x0020, 0x0041, 0x06B8, 0x0016, 0x0010, 0x002E, 0x04F8, 0x0500, 0x0026,
+    0x0020, 0x000E, 0x06A8, 0x0019, 0x0030, 0x0009, 0x0030, 0x0009, 0x0020, 0x0009, 0x0028, 0x0009,
+    0x0030, 0x0009, 0x06B0, 0x000E, 0x0028, 0x0026, 0x04F8, 0x04F8, 0x002E, 0x06D0, 0x0009, 0x0010,
+    0x0009, 0x0028, 0x0009, 0x0030, 0x0009, 0x0018, 0x0009, 0x0030, 0x0009, 0x0030, 0x0009, 0x06E0,
+    0x002E, 0x04F0, 0x04F8, 0x0026, 0x06D8, 0x0009, 0x0018, 0x0009, 0x0020, 0x0009, 0x0030, 0x0009,
+    0x0010, 0x0009, 0x0038, 0x0009, 0x0030, 0x0009, 0x06E8, 0x0026, 0x04F0, 0x04F0, 0x002E, 0x06D8,
+    0x0009, 0x0020, 0x0009, 0x0018, 0x0009, 0x0030, 0x0009, 0x0008, 0x0009, 0x0040, 0x0009, 0x0030,
+    0x0009, 0x06E8, 0x002E, 0x04E8, 0x04F0, 0x0026, 0x06E0, 0x0009, 0x0028, 0x0009, 0x0010, 0x0009,
+    0x0030, 0x0009, 0x0050, 0x0009, 0x0030, 0x0009, 0x06F0, 0x0026, 0x04E8, 0x04E8, 0x002E, 0x06E0,
+    0x0009, 0x0030, 0x0009, 0x0008, 0x0009, 0x0030, 0x0009, 0x0050, 0x0009, 0x0030, 0x0009, 0x06F0,
+    0x002E, 0x04E0, 0x04E8, 0x0026, 0x0768, 0x0009, 0x0788, 0x0026, 0x04E0, 0x04E0, 0x002E, 0x0EF8,
+    0x002E, 0x04D8, 0x04E0, 0x0026, 0x0F08, 0x0026, 0x04D8, 0x04D8, 0x002E, 0x0F08, 0x002E, 0x04D0,
+    0x04D8, 0x0026, 0x0F18, 0x0026, 0x04D0, 0x04D0, 0x002E, 0x0F18, 0x002E, 0x04C8, 0x04D0, 0x0026,
+    0x0F28, 0x0026, 0x04C8, 0x04C8, 0x002E, 0x0F28, 0x002E, 0x04C0, 0x04C8, 0x0026, 0x0F38, 0x0026,
+    0x04C0, 0x04C0, 0x002E, 0x0F38, 0x002E, 0x04B8, 0x04C0, 0x0026, 0x0F48, 0x0026, 0x04B8, 0x04B8,
+    0x002E, 0x0F48, 0x002E, 0x04B0, 0x04B8, 0x0026, 0x0F58, 0x0026, 0x04B0, 0x04B8, 0x0026, 0x0F58,
+    0x0026, 0x04B0, 0x04B0, 0x0026, 0x0F68, 0x0026, 0x04A8, 0x04B0, 0x0026, 0x0F68, 0x0026, 0x04A8,
+    0x04A8, 0x002E, 0x0F68, 0x002E, 0x04A0, 0x04A8, 0x0026, 0x0F78, 0x0026, 0x04A0, 0x04A0, 0x002E,
+    0x0F78, 0x002E, 0x0498, 0x04A0, 0x0026, 0x0F88, 0x0026, 0x0498, 0x04A0, 0x0026, 0x0F80, 0x002E,
+    0x0498, 0x0498, 0x0026, 0x0008, 0x0016, 0x0F60, 0x0016, 0x0010, 0x0026, 0x0490, 0x0498, 0x0026,
+    0x0018, 0x0016, 0x0F40, 0x0016, 0x0020, 0x0026, 0x0490, 0x0490, 0x002E, 0x0028, 0x001E, 0x0F10,
+    0x001E, 0x0030, 0x002E, 0x0488, 0x0490, 0x0026, 0x0048, 0x0016, 0x0EF0, 0x0016, 0x0050, 0x0026,
+    0x0488, 0x0490, 0x0026, 0x0058, 0x0016, 0x0ED0, 0x0016, 0x0060, 0x0026, 0x0488, 0x0488, 0x0026,
+    0x0070, 0x0016, 0x0EB0, 0x0016, 0x0078, 0x0026, 0x0480, 0x0488, 0x0026, 0x0FB8, 0x0026, 0x0480,
+    0x0480, 0x002E, 0x0FB8, 0x002E, 0x0478, 0x0480, 0x0026, 0x0160, 0x0011, 0x0030, 0x0021, 0x0028,
+    0x0021, 0x0BC0, 0x0031, 0x0020, 0x0021, 0x0028, 0x0021, 0x0148, 0x0026, 0x0478, 0x0480, 0x0026,
+    0x0158, 0x0019, 0x0028, 0x0031, 0x0018, 0x0031, 0x0BB0, 0x0041, 0x0010, 0x0031, 0x0018, 0x0031,
+    0x0140, 0x0026, 0x0478, 0x0478, 0x002E, 0x0150, 0x0021, 0x0020, 0x0019, 0x0010, 0x0019, 0x0008,
+    0x0019, 0x0010, 0x0019, 0x0BA8, 0x0009, 0x0028, 0x0011, 0x0008, 0x0019, 0x0010, 0x0019, 0x0008,
+    0x0019, 0x0010, 0x0019, 0x0138, 0x002E, 0x0470, 0x0478, 0x0026, 0x0168, 0x0011, 0x0020, 0x0011,
+    0x0020, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0BD0, 0x0019, 0x0008, 0x0011, 0x0020, 0x0011,
+    0x0008, 0x0011, 0x0020, 0x0011, 0x0140, 0x0026, 0x0470, 0x0478, 0x0026, 0x0168, 0x0011, 0x0020,
+    0x0011, 0x0020, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0BC0, 0x0021, 0x0010, 0x0011, 0x0020,
+    0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0140, 0x0026, 0x0470, 0x0470, 0x0026, 0x0170, 0x0011,
+    0x0020, 0x0011, 0x0020, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0BC0, 0x0021, 0x0010, 0x0011,
+    0x0020, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0148, 0x0026, 0x0468, 0x0470, 0x0026, 0x0170,
+    0x0011, 0x0020, 0x0011, 0x0020, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0BD0, 0x0019, 0x0008,
+    0x0011, 0x0020, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0148, 0x0026, 0x0468, 0x0470, 0x0026,
+    0x0170, 0x0011, 0x0020, 0x0011, 0x0020, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0BD8, 0x0011,
+    0x0008, 0x0011, 0x0020, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0148, 0x0026, 0x0468, 0x0468,
+    0x0026, 0x0178, 0x0011, 0x0020, 0x0019, 0x0010, 0x0019, 0x0008, 0x0019, 0x0010, 0x0019, 0x0BA8,
+    0x0009, 0x0028, 0x0011, 0x0008, 0x0019, 0x0010, 0x0019, 0x0008, 0x0019, 0x0010, 0x0019, 0x0150,
+    0x0026, 0x0460, 0x0468, 0x0026, 0x0168, 0x0031, 0x0018, 0x0031, 0x0018, 0x0031, 0x0BB0, 0x0041,
+    0x0010, 0x0031, 0x0018, 0x0031, 0x0158, 0x0026, 0x0460, 0x0468, 0x0026, 0x0168, 0x0031, 0x0020,
+    0x0021, 0x0028, 0x0021, 0x0BC0, 0x0031, 0x0020, 0x0021, 0x0028, 0x0021, 0x0160, 0x0026, 0x0460,
+    0x0460, 0x0026, 0x1008, 0x0026, 0x0458, 0x0460, 0x0026, 0x1008, 0x0026, 0x0458, 0x0460, 0x0026,
+    0x1008, 0x0026, 0x0458, 0x0458, 0x0026, 0x1018, 0x0026, 0x0450, 0x0458, 0x0026, 0x1018, 0x0026,
+    0x0450, 0x0458, 0x0026, 0x1018, 0x0026, 0x0450, 0x0450, 0x002E, 0x1018, 0x002E, 0x0448, 0x0450,
+    0x0026, 0x1028, 0x0026, 0x0448, 0x0450, 0x0026, 0x1028, 0x0026, 0x0448, 0x0448, 0x002E, 0x1028,
+    0x002E, 0x0440, 0x0448, 0x002E, 0x1020, 0x0036, 0x0440, 0x0448, 0x0026, 0x0008, 0x0016, 0x1000,
+    0x0016, 0x0010, 0x0026, 0x0440, 0x0448, 0x0026, 0x0018, 0x000E, 0x0FF0, 0x000E, 0x0020, 0x0026,
+    0x0440, 0x0440, 0x002E, 0x1038, 0x002E, 0x0438, 0x0440, 0x0026, 0x1048, 0x0026, 0x0438, 0x0440,
+    0x0026, 0x1048, 0x0026, 0x0438, 0x0440, 0x0026, 0x1048, 0x0026, 0x0438, 0x0438, 0x0026, 0x1058,
+    0x0026, 0x0430, 0x0438, 0x0026, 0x1058, 0x0026, 0x0430, 0x0438, 0x0026, 0x1058, 0x0026, 0x0430,
+    0x0438, 0x0026, 0x1058, 0x0026, 0x0430, 0x0430, 0x0026, 0x1068, 0x0026, 0x0428, 0x0430, 0x0026,
+    0x1068, 0x0026, 0x0428, 0x0430, 0x0026, 0x1068, 0x0026, 0x0428, 0x0430, 0x0026, 0x1068, 0x0026,
+    0x0428, 0x0428, 0x002E, 0x1068, 0x002E, 0x0420, 0x0428, 0x0026, 0x1078, 0x0026, 0x0420, 0x0428,
+    0x0026, 0x1078, 0x0026, 0x0420, 0x0428, 0x0026, 0x1078, 0x0026, 0x0420, 0x0428, 0x0026, 0x1078,
+    0x0026, 0x0420, 0x0420, 0x0026, 0x1088, 0x0026, 0x0418, 0x0420, 0x0026, 0x1088, 0x0026, 0x0418,
+    0x0420, 0x0026, 0x1088, 0x0026, 0x0418, 0x0420, 0x0026, 0x1088, 0x0026, 0x0418, 0x0420, 0x0026,
+    0x1088, 0x0026, 0x0418, 0x0418, 0x0026, 0x1098, 0x0026, 0x0410, 0x0418, 0x0026, 0x1098, 0x0026,
+    0x0410, 0x0418, 0x0026, 0x1098, 0x0026, 0x0410, 0x0418, 0x0026, 0x1098, 0x0026, 0x0410, 0x0418,
+    0x0026, 0x1098, 0x0026, 0x0410, 0x0418, 0x0026, 0x1098, 0x0026, 0x0410, 0x0410, 0x0036, 0x1080,
+    0x003E, 0x0408, 0x0410, 0x0026, 0x0010, 0x001E, 0x1050, 0x001E, 0x0018, 0x0026, 0x0408, 0x0410,
+    0x0026, 0x10A8, 0x0026, 0x0408, 0x0410, 0x0026, 0x10A8, 0x0026, 0x0408, 0x0410, 0x0026, 0x10A8,
+    0x0026, 0x0408, 0x0410, 0x0026, 0x10A8, 0x0026, 0x0408, 0x0410, 0x0026, 0x10A8, 0x0026, 0x0408,
+    0x0408, 0x0026, 0x10B8, 0x0026, 0x0400, 0x0408, 0x0026, 0x10B8, 0x0026, 0x0400, 0x0408, 0x0026,
+    0x10B8, 0x0026, 0x0400, 0x0408, 0x0026, 0x10B8, 0x0026, 0x0400, 0x0408, 0x0026, 0x10B8, 0x0026,
+    0x0400, 0x0408, 0x0026, 0x10B8, 0x0026, 0x0400, 0x0408, 0x0026, 0x10B8, 0x0026, 0x0400, 0x0408,
+    0x0026, 0x10B8, 0x0026, 0x0400, 0x0400, 0x0026, 0x10C8, 0x0026, 0x03F8, 0x0400, 0x0026, 0x10C8,
+    0x0026, 0x03F8, 0x0400, 0x0026, 0x10C8, 0x0026, 0x03F8, 0x0400, 0x0026, 0x10C8, 0x0026, 0x03F8,
+    0x0400, 0x0026, 0x10C8, 0x0026, 0x03F8, 0x0400, 0x0026, 0x10C8, 0x0026, 0x03F8, 0x0400, 0x0026,
+    0x10C8, 0x0026, 0x03F8, 0x0400, 0x0026, 0x10C8, 0x0026, 0x03F8, 0x0400, 0x0026, 0x10C8, 0x0026,
+    0x03F8, 0x0400, 0x0026, 0x10C8, 0x0026, 0x03F8, 0x0400, 0x0026, 0x10C8, 0x0026, 0x03F8, 0x0400,
+    0x0026, 0x10C8, 0x0026, 0x03F8, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8,
+    0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0,
+    0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x004E, 0x1080, 0x0056, 0x03F0, 0x03F8, 0x0026,
+    0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026,
+    0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8,
+    0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8,
+    0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0,
+    0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026,
+    0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026,
+    0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8,
+    0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8,
+    0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0,
+    0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026,
+    0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026, 0x03F0, 0x03F8, 0x0026, 0x10D8, 0x0026,
+    0x03F0, 0x0400, 0x0026, 0x10C8, 0x0026, 0x03F8, 0x0400, 0x0026, 0x10C8, 0x0026, 0x03F8, 0x0400,
+    0x0026, 0x10C8, 0x0026, 0x03F8, 0x0400, 0x0026, 0x0008, 0x001E, 0x1080, 0x001E, 0x0010, 0x0026,
+    0x03F8, 0x0400, 0x002E, 0x10B0, 0x0036, 0x03F8, 0x0400, 0x0026, 0x10C8, 0x0026, 0x03F8, 0x0400,
+    0x0026, 0x10C8, 0x0026, 0x03F8, 0x0400, 0x0026, 0x10C8, 0x0026, 0x03F8, 0x0400, 0x0026, 0x10C8,
+    0x0026, 0x03F8, 0x0400, 0x0026, 0x10C8, 0x0026, 0x03F8, 0x0400, 0x0026, 0x10C8, 0x0026, 0x03F8,
+    0x0400, 0x0026, 0x10C8, 0x0026, 0x03F8, 0x0408, 0x0026, 0x10B8, 0x0026, 0x0400, 0x0408, 0x0026,
+    0x10B8, 0x0026, 0x0400, 0x0408, 0x0026, 0x10B8, 0x0026, 0x0400, 0x0408, 0x0026, 0x10B8, 0x0026,
+    0x0400, 0x0408, 0x0026, 0x10B8, 0x0026, 0x0400, 0x0408, 0x0026, 0x10B8, 0x0026, 0x0400, 0x0408,
+    0x0026, 0x10B8, 0x0026, 0x0400, 0x0408, 0x0026, 0x10B8, 0x0026, 0x0400, 0x0410, 0x0026, 0x10A8,
+    0x0026, 0x0408, 0x0410, 0x0026, 0x0150, 0x0039, 0x0020, 0x0021, 0x0CD8, 0x0031, 0x0010, 0x0039,
+    0x0020, 0x0021, 0x0150, 0x0026, 0x0408, 0x0410, 0x0026, 0x0150, 0x0039, 0x0018, 0x0031, 0x0CC8,
+    0x0041, 0x0008, 0x0039, 0x0018, 0x0031, 0x0148, 0x0026, 0x0408, 0x0410, 0x0026, 0x0150, 0x0011,
+    0x0038, 0x0019, 0x0010, 0x0019, 0x0CC0, 0x0009, 0x0028, 0x0011, 0x0008, 0x0011, 0x0038, 0x0019,
+    0x0010, 0x0019, 0x0140, 0x0026, 0x0408, 0x0410, 0x0026, 0x0150, 0x0011, 0x0038, 0x0011, 0x0020,
+    0x0011, 0x0CE8, 0x0019, 0x0008, 0x0011, 0x0038, 0x0011, 0x0020, 0x0011, 0x0140, 0x0026, 0x0408,
+    0x0410, 0x0026, 0x0150, 0x0031, 0x0018, 0x0011, 0x0020, 0x0011, 0x0CD8, 0x0021, 0x0010, 0x0031,
+    0x0018, 0x0011, 0x0020, 0x0011, 0x0140, 0x0026, 0x0408, 0x0410, 0x0026, 0x0150, 0x0039, 0x0010,
+    0x0011, 0x0020, 0x0011, 0x0CD8, 0x0021, 0x0010, 0x0039, 0x0010, 0x0011, 0x0020, 0x0011, 0x0140,
+    0x0026, 0x0408, 0x0418, 0x0026, 0x0170, 0x0019, 0x0008, 0x0011, 0x0020, 0x0011, 0x0CE8, 0x0019,
+    0x0030, 0x0019, 0x0008, 0x0011, 0x0020, 0x0011, 0x0138, 0x0026, 0x0410, 0x0418, 0x0026, 0x0178,
+    0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0CF0, 0x0011, 0x0038, 0x0011, 0x0008, 0x0011, 0x0020,
+    0x0011, 0x0138, 0x0026, 0x0410, 0x0418, 0x0026, 0x0148, 0x0011, 0x0020, 0x0011, 0x0008, 0x0019,
+    0x0010, 0x0019, 0x0CC0, 0x0009, 0x0028, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0008, 0x0019,
+    0x0010, 0x0019, 0x0138, 0x0026, 0x0410, 0x0418, 0x0026, 0x0148, 0x0039, 0x0018, 0x0031, 0x0CC8,
+    0x0041, 0x0008, 0x0039, 0x0018, 0x0031, 0x0140, 0x0026, 0x0410, 0x0418, 0x0026, 0x0150, 0x0029,
+    0x0028, 0x0021, 0x0CD8, 0x0031, 0x0018, 0x0029, 0x0028, 0x0021, 0x0148, 0x0026, 0x0410, 0x0418,
+    0x0026, 0x0060, 0x001E, 0x0FA0, 0x001E, 0x0068, 0x0026, 0x0410, 0x0420, 0x0026, 0x0038, 0x0026,
+    0x0FB8, 0x0013, 0x0008, 0x0026, 0x0040, 0x0026, 0x0418, 0x0420, 0x0026, 0x0010, 0x002E, 0x0FD8,
+    0x003B, 0x002E, 0x0018, 0x0026, 0x0418, 0x0420, 0x0036, 0x1000, 0x003B, 0x0028, 0x003E, 0x0418,
+    0x0420, 0x0026, 0x1008, 0x0043, 0x0040, 0x0026, 0x0418, 0x0420, 0x0026, 0x1008, 0x003B, 0x0048,
+    0x0026, 0x0418, 0x0428, 0x0026, 0x1000, 0x003B, 0x0040, 0x0026, 0x0420, 0x0428, 0x0026, 0x1000,
+    0x003B, 0x0040, 0x0026, 0x0420, 0x0428, 0x0026, 0x1000, 0x003B, 0x0040, 0x0026, 0x0420, 0x0428,
+    0x0026, 0x0FF8, 0x003B, 0x0048, 0x0026, 0x0420, 0x0428, 0x002E, 0x0FF0, 0x003B, 0x0040, 0x002E,
+    0x0420, 0x0430, 0x0026, 0x0FF0, 0x003B, 0x0040, 0x0026, 0x0428, 0x0430, 0x0026, 0x0FF0, 0x003B,
+    0x0040, 0x0026, 0x0428, 0x0430, 0x0026, 0x0FE8, 0x0043, 0x0040, 0x0026, 0x0428, 0x0430, 0x0026,
+    0x0FE8, 0x003B, 0x0048, 0x0026, 0x0428, 0x0438, 0x0026, 0x0FE0, 0x003B, 0x0040, 0x0026, 0x0430,
+    0x0438, 0x0026, 0x0FE0, 0x003B, 0x0040, 0x0026, 0x0430, 0x0438, 0x0026, 0x0FD8, 0x0043, 0x0040,
+    0x0026, 0x0430, 0x0438, 0x0026, 0x0FD8, 0x003B, 0x0048, 0x0026, 0x0430, 0x0440, 0x0026, 0x0FD0,
+    0x003B, 0x0040, 0x0026, 0x0438, 0x0440, 0x0026, 0x0FC8, 0x0043, 0x0040, 0x0026, 0x0438, 0x0440,
+    0x0026, 0x0FC8, 0x003B, 0x0048, 0x0026, 0x0438, 0x0440, 0x002E, 0x0FC0, 0x003B, 0x0040, 0x002E,
+    0x0438, 0x0448, 0x0026, 0x0FC0, 0x003B, 0x0040, 0x0026, 0x0440, 0x0448, 0x0026, 0x0FB8, 0x0043,
+    0x0040, 0x0026, 0x0440, 0x0448, 0x0026, 0x0FB8, 0x003B, 0x0048, 0x0026, 0x0440, 0x0448, 0x002E,
+    0x0FB0, 0x003B, 0x0040, 0x002E, 0x0440, 0x0450, 0x0026, 0x0FA8, 0x0043, 0x0040, 0x0026, 0x0448,
+    0x0450, 0x0026, 0x0FA8, 0x003B, 0x0048, 0x0026, 0x0448, 0x0450, 0x002E, 0x0FA0, 0x003B, 0x0040,
+    0x002E, 0x0448, 0x0458, 0x0026, 0x0F98, 0x0043, 0x0040, 0x0026, 0x0450, 0x0458, 0x0026, 0x0F98,
+    0x003B, 0x0048, 0x0026, 0x0450, 0x0458, 0x0026, 0x0020, 0x000E, 0x0F70, 0x003B, 0x0018, 0x000E,
+    0x0028, 0x0026, 0x0450, 0x0460, 0x0026, 0x0008, 0x0016, 0x0F70, 0x0043, 0x0020, 0x0016, 0x0010,
+    0x0026, 0x0458, 0x0460, 0x002E, 0x0F80, 0x003B, 0x0038, 0x0036, 0x0458, 0x0460, 0x0026, 0x0F88,
+    0x003B, 0x0048, 0x0026, 0x0458, 0x0468, 0x0026, 0x0F78, 0x0043, 0x0040, 0x0026, 0x0460, 0x0468,
+    0x0026, 0x0F78, 0x003B, 0x0048, 0x0026, 0x0460, 0x0468, 0x0026, 0x0F78, 0x003B, 0x0048, 0x0026,
+    0x0460, 0x0470, 0x0026, 0x0F68, 0x0043, 0x0040, 0x0026, 0x0468, 0x0470, 0x0026, 0x0F68, 0x003B,
+    0x0048, 0x0026, 0x0468, 0x0470, 0x0026, 0x0F68, 0x003B, 0x0048, 0x0026, 0x0468, 0x0478, 0x0026,
+    0x0F58, 0x0043, 0x0040, 0x0026, 0x0470, 0x0478, 0x0026, 0x0F58, 0x003B, 0x0048, 0x0026, 0x0470,
+    0x0478, 0x002E, 0x0F48, 0x0043, 0x0040, 0x002E, 0x0470, 0x0480, 0x0026, 0x0F48, 0x0043, 0x0040,
+    0x0026, 0x0478, 0x0480, 0x0026, 0x0F48, 0x003B, 0x0048, 0x0026, 0x0478, 0x0480, 0x002E, 0x0F38,
+    0x0043, 0x0040, 0x002E, 0x0478, 0x0488, 0x0026, 0x0F38, 0x003B, 0x0048, 0x0026, 0x0480, 0x0488,
+    0x0026, 0x0F30, 0x0043, 0x0048, 0x0026, 0x0480, 0x0490, 0x0026, 0x0F28, 0x0043, 0x0040, 0x0026,
+    0x0488, 0x0490, 0x0026, 0x0F28, 0x003B, 0x0048, 0x0026, 0x0488, 0x0490, 0x002E, 0x0F18, 0x0043,
+    0x0040, 0x002E, 0x0488, 0x0498, 0x0026, 0x0F18, 0x003B, 0x0048, 0x0026, 0x0490, 0x0498, 0x0026,
+    0x0F10, 0x0043, 0x0048, 0x0026, 0x0490, 0x04A0, 0x0026, 0x0F08, 0x003B, 0x0048, 0x0026, 0x0498,
+    0x04A0, 0x0026, 0x0F00, 0x0043, 0x0048, 0x0026, 0x0498, 0x04A0, 0x002E, 0x0EF8, 0x0043, 0x0040,
+    0x002E, 0x0498, 0x04A8, 0x0026, 0x0EF0, 0x0043, 0x0048, 0x0026, 0x04A0, 0x04A8, 0x002E, 0x0EE8,
+    0x0043, 0x0040, 0x002E, 0x04A0, 0x04B0, 0x0026, 0x0EE0, 0x0043, 0x0048, 0x0026, 0x04A8, 0x04B0,
+    0x0026, 0x0028, 0x000E, 0x0EB0, 0x0043, 0x0010, 0x000E, 0x0030, 0x0026, 0x04A8, 0x04B8, 0x0026,
+    0x0010, 0x0016, 0x0EB8, 0x003B, 0x0020, 0x0016, 0x0018, 0x0026, 0x04B0, 0x04B8, 0x0036, 0x0EC0,
+    0x0043, 0x0030, 0x0016, 0x0008, 0x0026, 0x04B0, 0x04B8, 0x002E, 0x0EC8, 0x003B, 0x0048, 0x002E,
+    0x04B0, 0x04C0, 0x0026, 0x0EC0, 0x0043, 0x0048, 0x0026, 0x04B8, 0x04C0, 0x002E, 0x0EB8, 0x003B,
+    0x0048, 0x002E, 0x04B8, 0x04C8, 0x0026, 0x0EB0, 0x0043, 0x0048, 0x0026, 0x04C0, 0x04C8, 0x002E,
+    0x0EA8, 0x003B, 0x0048, 0x002E, 0x04C0, 0x04D0, 0x0026, 0x0EA0, 0x0043, 0x0048, 0x0026, 0x04C8,
+    0x04D0, 0x002E, 0x0E90, 0x0043, 0x0048, 0x002E, 0x04C8, 0x04D8, 0x0026, 0x0E90, 0x0043, 0x0048,
+    0x0026, 0x04D0, 0x04D8, 0x002E, 0x0E80, 0x0043, 0x0048, 0x002E, 0x04D0, 0x04E0, 0x0026, 0x0E80,
+    0x0043, 0x0048, 0x0026, 0x04D8, 0x04E0, 0x002E, 0x0E70, 0x0043, 0x0048, 0x002E, 0x04D8, 0x04E8,
+    0x0026, 0x0E70, 0x0043, 0x0048, 0x0026, 0x04E0, 0x04E8, 0x002E, 0x0E60, 0x0043, 0x0048, 0x002E,
+    0x04E0, 0x04F0, 0x0026, 0x0E60, 0x0043, 0x0048, 0x0026, 0x04E8, 0x04F0, 0x002E, 0x0E50, 0x0043,
+    0x0048, 0x002E, 0x04E8, 0x04F8, 0x0026, 0x0E48, 0x004B, 0x0048, 0x0026, 0x04F0, 0x04F8, 0x002E,
+    0x0E40, 0x0043, 0x0048, 0x002E, 0x04F0, 0x0500, 0x0026, 0x0E38, 0x0043, 0x0050, 0x0026, 0x04F8,
+    0x0500, 0x002E, 0x0E30, 0x0043, 0x0048, 0x002E, 0x04F8, 0x0508, 0x002E, 0x0E20, 0x0043, 0x0048,
+    0x002E, 0x0500, 0x0510, 0x0026, 0x0E18, 0x004B, 0x0048, 0x0026, 0x0508, 0x0510, 0x002E, 0x0E10,
+    0x0043, 0x0048, 0x002E, 0x0508, 0x0518, 0x0026, 0x0E08, 0x0043, 0x0050, 0x0026, 0x0510, 0x0518,
+    0x002E, 0x0E00, 0x0043, 0x0048, 0x002E, 0x0510, 0x0520, 0x0026, 0x0DF8, 0x0043, 0x0050, 0x0026,
+    0x0518, 0x0520, 0x002E, 0x0028, 0x000E, 0x0DB8, 0x004B, 0x0010, 0x000E, 0x0030, 0x002E, 0x0518,
+    0x0528, 0x002E, 0x0010, 0x0016, 0x0DC0, 0x0043, 0x0020, 0x0016, 0x0018, 0x002E, 0x0520, 0x0530,
+    0x0036, 0x0DC8, 0x0043, 0x0038, 0x0016, 0x0008, 0x0026, 0x0528, 0x0530, 0x002E, 0x0DC8, 0x004B,
+    0x0048, 0x002E, 0x0528, 0x0538, 0x0026, 0x0DC8, 0x0043, 0x0050, 0x0026, 0x0530, 0x0538, 0x002E,
+    0x0DB8, 0x0043, 0x0050, 0x002E, 0x0530, 0x0540, 0x002E, 0x0DA8, 0x004B, 0x0048, 0x002E, 0x0538,
+    0x0548, 0x0026, 0x0DA8, 0x0043, 0x0050, 0x0026, 0x0540, 0x0548, 0x002E, 0x0D98, 0x0043, 0x0050,
+    0x002E, 0x0540, 0x0550, 0x002E, 0x0D88, 0x004B, 0x0048, 0x002E, 0x0548, 0x0558, 0x0026, 0x0D88,
+    0x0043, 0x0050, 0x0026, 0x0550, 0x0558, 0x002E, 0x0D78, 0x0043, 0x0050, 0x002E, 0x0550, 0x0560,
+    0x002E, 0x0D68, 0x004B, 0x0048, 0x002E, 0x0558, 0x0560, 0x002E, 0x0D60, 0x004B, 0x0050, 0x002E,
+    0x0558, 0x0568, 0x002E, 0x0D58, 0x0043, 0x0050, 0x002E, 0x0560, 0x0570, 0x002E, 0x0D48, 0x004B,
+    0x0048, 0x002E, 0x0568, 0x0570, 0x002E, 0x0D40, 0x004B, 0x0050, 0x002E, 0x0568, 0x0578, 0x002E,
+    0x0D30, 0x004B, 0x0050, 0x002E, 0x0570, 0x0580, 0x002E, 0x01E0, 0x0021, 0x0948, 0x0019, 0x0020,
+    0x0021, 0x0028, 0x0021, 0x0140, 0x0043, 0x0050, 0x002E, 0x0578, 0x0588, 0x0026, 0x01D8, 0x0031,
+    0x0938, 0x0021, 0x0018, 0x0031, 0x0018, 0x0031, 0x0130, 0x004B, 0x0050, 0x0026, 0x0580, 0x0588,
+    0x002E, 0x01C8, 0x0019, 0x0010, 0x0019, 0x0928, 0x0029, 0x0010, 0x0019, 0x0010, 0x0019, 0x0008,
+    0x0019, 0x0010, 0x0019, 0x0120, 0x004B, 0x0050, 0x002E, 0x0580, 0x0590, 0x002E, 0x01C0, 0x0011,
+    0x0020, 0x0011, 0x0920, 0x0011, 0x0008, 0x0019, 0x0010, 0x0011, 0x0020, 0x0011, 0x0008, 0x0011,
+    0x0020, 0x0011, 0x0118, 0x004B, 0x0050, 0x002E, 0x0588, 0x0598, 0x002E, 0x01B8, 0x0011, 0x0020,
+    0x0011, 0x0918, 0x0011, 0x0010, 0x0019, 0x0010, 0x0011, 0x0020, 0x0011, 0x0008, 0x0011, 0x0020,
+    0x0011, 0x0110, 0x004B, 0x0050, 0x002E, 0x0590, 0x0598, 0x002E, 0x01B8, 0x0011, 0x0020, 0x0011,
+    0x0918, 0x0009, 0x0018, 0x0019, 0x0010, 0x0011, 0x0020, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011,
+    0x0110, 0x004B, 0x0050, 0x002E, 0x0590, 0x05A0, 0x002E, 0x01B0, 0x0011, 0x0020, 0x0011, 0x0918,
+    0x0041, 0x0008, 0x0011, 0x0020, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0108, 0x004B, 0x0050,
+    0x002E, 0x0598, 0x05A8, 0x002E, 0x01A8, 0x0011, 0x0020, 0x0011, 0x0918, 0x0041, 0x0008, 0x0011,
+    0x0020, 0x0011, 0x0008, 0x0011, 0x0020, 0x0011, 0x0100, 0x004B, 0x0050, 0x002E, 0x05A0, 0x05B0,
+    0x002E, 0x0020, 0x000E, 0x0178, 0x0019, 0x0010, 0x0019, 0x0938, 0x0019, 0x0010, 0x0019, 0x0010,
+    0x0019, 0x0008, 0x0019, 0x0010, 0x0019, 0x00F8, 0x004B, 0x0020, 0x000E, 0x0028, 0x002E, 0x05A8,
+    0x05B0, 0x002E, 0x0018, 0x000E, 0x0188, 0x0031, 0x0940, 0x0019, 0x0018, 0x0031, 0x0018, 0x0031,
+    0x00F8, 0x004B, 0x0030, 0x000E, 0x0020, 0x002E, 0x05A8, 0x05B8, 0x003E, 0x0198, 0x0021, 0x0948,
+    0x0019, 0x0020, 0x0021, 0x0028, 0x0021, 0x00F8, 0x0053, 0x0038, 0x0016, 0x0008, 0x002E, 0x05B0,
+    0x05C0, 0x002E, 0x0CA0, 0x004B, 0x0050, 0x002E, 0x05B8, 0x05C8, 0x002E, 0x0C90, 0x004B, 0x0050,
+    0x002E, 0x05C0, 0x05C8, 0x0036, 0x0C80, 0x004B, 0x0050, 0x0036, 0x05C0, 0x05D0, 0x002E, 0x0C78,
+    0x004B, 0x0058, 0x002E, 0x05C8, 0x05D8, 0x002E, 0x0C68, 0x004B, 0x0058, 0x002E, 0x05D0, 0x05E0,
+    0x002E, 0x0C58, 0x004B, 0x0058, 0x002E, 0x05D8, 0x05E8, 0x002E, 0x0C48, 0x0053, 0x0050, 0x002E,
+    0x05E0, 0x05E8, 0x0036, 0x0C38, 0x0053, 0x0050, 0x0036, 0x05E0, 0x05F0, 0x0036, 0x0C28, 0x0053,
+    0x0050, 0x0036, 0x05E8, 0x05F8, 0x002E, 0x0C20, 0x0053, 0x0058, 0x002E, 0x05F0, 0x0600, 0x002E,
+    0x0C10, 0x0053, 0x0058, 0x002E, 0x05F8, 0x0608, 0x002E, 0x0C00, 0x0053, 0x0058, 0x002E, 0x0600,
+    0x0610, 0x002E, 0x0BF0, 0x0053, 0x0058, 0x002E, 0x0608, 0x0618, 0x002E, 0x0098, 0x000E, 0x0B40,
+    0x000E, 0x004B, 0x0058, 0x002E, 0x0610, 0x0618, 0x0036, 0x0088, 0x000E, 0x0B50, 0x000E, 0x003B,
+    0x0058, 0x0036, 0x0610, 0x0620, 0x0036, 0x0078, 0x000E, 0x0B60, 0x000E, 0x002B, 0x0058, 0x0036,
+    0x0618, 0x0628, 0x0036, 0x0068, 0x000E, 0x0B70, 0x000E, 0x001B, 0x0058, 0x0036, 0x0620, 0x0630,
+    0x0036, 0x0058, 0x000E, 0x0B80, 0x000E, 0x000B, 0x0058, 0x0036, 0x0628, 0x0638, 0x0036, 0x0048,
+    0x000E, 0x0B90, 0x000E, 0x0050, 0x0036, 0x0630, 0x0640, 0x002E, 0x0040, 0x000E, 0x0BA0, 0x000E,
+    0x0048, 0x002E, 0x0638, 0x0648, 0x002E, 0x0030, 0x000E, 0x0BB0, 0x000E, 0x0038, 0x002E, 0x0640,
+    0x0650, 0x002E, 0x0020, 0x000E, 0x0BC0, 0x000E, 0x0028, 0x002E, 0x0648, 0x0658, 0x002E, 0x0010,
+    0x000E, 0x0BD0, 0x000E, 0x0018, 0x002E, 0x0650, 0x0660, 0x0036, 0x0BE0, 0x000E, 0x0008, 0x002E,
+    0x0658, 0x0668, 0x002E, 0x0BE8, 0x002E, 0x0660, 0x0670, 0x001E, 0x0BF8, 0x001E, 0x0668, 0x0678,
+    0x000E, 0x0C08, 0x000E, 0x0670, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900,
+};
+
+const uint16_t dial_rle_row[481] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 10, 13, 16, 19,
+    26, 33, 44, 55, 66, 77, 84, 91, 102, 113, 124, 135,
+    142, 149, 156, 161, 166, 175, 184, 193, 202, 207, 212, 217,
+    222, 227, 232, 237, 242, 247, 256, 265, 274, 279, 284, 289,
+    294, 299, 304, 309, 314, 319, 330, 341, 358, 373, 392, 411,
+    430, 449, 468, 483, 498, 507, 516, 525, 534, 539, 544, 549,
+    554, 559, 564, 569, 574, 583, 592, 601, 606, 611, 616, 621,
+    626, 631, 636, 641, 646, 651, 656, 661, 678, 695, 718, 739,
+    760, 781, 802, 827, 856, 877, 894, 899, 904, 909, 914, 919,
+    924, 929, 934, 939, 944, 949, 954, 959, 964, 969, 974, 979,
+    984, 989, 994, 1001, 1010, 1019, 1024, 1029, 1034, 1039, 1044, 1049,
+    1054, 1059, 1064, 1069, 1074, 1079, 1084, 1089, 1094, 1099, 1104, 1109,
+    1114, 1119, 1136, 1155, 1178, 1199, 1222, 1243, 1262, 1281, 1300, 1317,
+    1334, 1341, 1346, 1351, 1356, 1361, 1366, 1371, 1376, 1381, 1386, 1391,
+    1396, 1401, 1406, 1411, 1416, 1421, 1426, 1431, 1436, 1441, 1450, 1459,
+    1468, 1477, 1486, 1495, 1500, 1505, 1522, 1539, 1566, 1591, 1616, 1641,
+    1666, 1691, 1718, 1735, 1752, 1757, 1762, 1767, 1772, 1777, 1782, 1787,
+    1792, 1797, 1802, 1807, 1816, 1825, 1830, 1835, 1840, 1845, 1850, 1855,
+    1860, 1865, 1870, 1875, 1880, 1885, 1890, 1895, 1900, 1905, 1910, 1915,
+    1920, 1925, 1930, 1935, 1940, 1945, 1950, 1955, 1960, 1965, 1970, 1979,
+    1984, 1989, 1994, 1999, 2004, 2009, 2014, 2019, 2024, 2029, 2034, 2039,
+    2044, 2049, 2054, 2059, 2064, 2069, 2074, 2079, 2084, 2089, 2094, 2099,
+    2104, 2109, 2114, 2119, 2124, 2129, 2134, 2139, 2144, 2149, 2154, 2159,
+    2164, 2169, 2174, 2179, 2184, 2189, 2194, 2199, 2204, 2209, 2214, 2219,
+    2224, 2229, 2234, 2239, 2244, 2249, 2254, 2259, 2264, 2269, 2274, 2279,
+    2284, 2293, 2298, 2303, 2308, 2313, 2318, 2323, 2328, 2333, 2338, 2343,
+    2348, 2353, 2358, 2363, 2368, 2373, 2378, 2393, 2408, 2429, 2448, 2467,
+    2486, 2505, 2524, 2549, 2564, 2579, 2588, 2599, 2609, 2616, 2623, 2630,
+    2637, 2644, 2651, 2658, 2665, 2672, 2679, 2686, 2693, 2700, 2707, 2714,
+    2721, 2728, 2735, 2742, 2749, 2756, 2763, 2770, 2777, 2784, 2791, 2798,
+    2805, 2812, 2823, 2834, 2841, 2848, 2855, 2862, 2869, 2876, 2883, 2890,
+    2897, 2904, 2911, 2918, 2925, 2932, 2939, 2946, 2953, 2960, 2967, 2974,
+    2981, 2988, 2995, 3002, 3009, 3016, 3023, 3034, 3045, 3054, 3061, 3068,
+    3075, 3082, 3089, 3096, 3103, 3110, 3117, 3124, 3131, 3138, 3145, 3152,
+    3159, 3166, 3173, 3180, 3187, 3194, 3201, 3208, 3215, 3222, 3229, 3240,
+    3251, 3260, 3267, 3274, 3281, 3288, 3295, 3302, 3309, 3316, 3323, 3330,
+    3337, 3344, 3351, 3358, 3365, 3380, 3395, 3416, 3439, 3462, 3485, 3506,
+    3527, 3552, 3571, 3588, 3595, 3602, 3609, 3616, 3623, 3630, 3637, 3644,
+    3651, 3658, 3665, 3672, 3679, 3689, 3699, 3709, 3719, 3729, 3738, 3747,
+    3756, 3765, 3774, 3781, 3786, 3791, 3796, 3797, 3798, 3799, 3800, 3801,
+    3802,
+};
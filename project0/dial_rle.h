@@ -0,0 +1,16 @@
+// Generated by host/gen_dial.c (make -C project0/host dial), do not edit
+#ifndef DIAL_RLE_H_
+#define DIAL_RLE_H_
+
+#include <stdint.h>
+
+#define DIAL_RLE_STYLE_ARC 1       // gauge styles of the image
+#define DIAL_RLE_STYLE_LINEAR 0
+#define DIAL_RLE_RUNS 3802          // 7604 bytes runs + 962 bytes row table in flash
+#define DIAL_RLE_LEN(run) ((run) >> 3)
+#define DIAL_RLE_INDEX(run) ((run) & 7)  // colorarray index
+
+extern const uint16_t dial_rle[DIAL_RLE_RUNS];
+extern const uint16_t dial_rle_row[481];     // first run of each row, [480]: end
+
+#endif
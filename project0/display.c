@@ -1,19 +1,28 @@
 #include <stdint.h>
 #include <stdbool.h> // type bool for giop.h
-#include <string.h>
-#include <math.h>
-#include "inc/hw_types.h"
-#include "inc/tm4c1294ncpdt.h"
-#include <stdio.h>   // Debug only
-#include <driverlib/sysctl.h>
-#include <driverlib/gpio.h>     // GPIO_PIN_X
-#include <inc/hw_memmap.h>      // GPIO_PORTX_BASE
+#include <stdlib.h>  // abs
 
 #include "display.h"
+#include "display_bus.h"
+#include "framebuffer.h"
+#include "needle_table.h"
+#include "bg_mask.h"
+#include "fixmath.h"
+#include "gauge_layout.h"
+#include "gauge_tables.h"
+#include "widget.h"
+
+// Static dial from flash (dial_rle.c, generated by host/gen_dial.c) instead of drawing it
+// at boot, also the source for restoring the background under the needle.
+// USE_RLE_BACKGROUND defaults to 1 in bg_mask.h, the mask is only built without it.
+#if USE_RLE_BACKGROUND
+#include "dial_rle.h"
+#if DIAL_RLE_STYLE_ARC != GAUGE_STYLE_ARC || DIAL_RLE_STYLE_LINEAR != GAUGE_STYLE_LINEAR
+#error "dial_rle.c was generated for other gauge styles, run make -C project0/host dial"
+#endif
+#endif
 
 // Macros/constants for display initialization
-#define RST 0x10
-#define INITIAL_STATE (0x1F)
 #define SOFTWARE_RESET (0x01)
 #define SET_PLL_MN (0xE2)
 #define START_PLL (0xE0)
@@ -32,20 +41,13 @@
 #define MAX_Y 480
 
 /********************************************************************************/
-// Gauge Macros
+// Gauge Macros (gauge geometry: gauge_layout.h)
 /********************************************************************************/
 // Std character sizes
 #define CHAR_HEIGHT 12  
 #define CHAR_WIDTH 8
 
-// Horizontal needle gauge
-// #define GAUGE_WIDTH 800         // Gauge spans 800 pixels (2 per speed unit)
-// #define GAUGE_HEIGHT 240        // From which position the height of the gauge starts
-// #define NEEDLE_HEIGHT 200       // Height of needle
-// #define TICK_HEIGHT 5           // Length of gauge tick
-
-#define SPEED_CHAR_HEIGHT 20    // Height of number characters beneath the gauge lines
-#define ODO_CHAR_HEIGHT 80      // Height of number characters of the Odometer and Direction
+#define ODO_CHAR_HEIGHT 80      // Height of the large digits of the digital speed readout
 
 #define XDIR 394    // Starting X-coord for direction
 #define YDIR 310    // Starting Y-coord for direction
@@ -53,38 +55,71 @@
 #define XODO 364    // Starting X-coord for Odometer
 #define YODO 330    // Starting Y-coord for Odometer
 
-#define XTSPD 382   // Starting X-coord for KM/H
-#define YTSPD 145   // Starting Y-coord for KM/H
-
 #define XWARN 388
 #define YWARN 350
 
-#define MAX_SPEED 400.0f
-#define CENTER_POINT_X 400
-#define CENTER_POINT_Y 280
-#define OUTER_ARC_RAD 270   // Radius for ticks arc
-#define INNER_ARC_RAD 255   // Radius for border arc
-#define NEEDLE_LENGTH 245   
-#define NUM_TICKS 40        // Tick every 10 km/h
-#define SHORT_TICK 5        // Length of short tick
-#define LONG_TICK 15        // Length of long tick
-#define SPEED_STEP 10       // Speedometer pos. where ticks are marked
-#define S_FACTOR 0.3f       // Slow smoothing factor for needle movement, 1.0 is instant
+#define S_FACTOR FIX16_CONST(0.3)   // Slow smoothing factor for needle movement, 1.0 is instant
+#define S_SNAP FIX16_CONST(0.01)    // Below this difference the needle jumps to the target
+
+// Count every strobe on the display bus (command + data), 0 to compile out
+#ifndef DISPLAY_BUS_STATS
+#define DISPLAY_BUS_STATS 1
+#endif
+
+#if DISPLAY_BUS_STATS
+#define BUS_COUNT() (bus_writes++)
+#define BUS_ADD(n) (bus_writes += (n))
+#else
+#define BUS_COUNT()
+#define BUS_ADD(n)
+#endif
 
 /********************************************************************************/
 // Global Variables 
 /********************************************************************************/
 // uint32_t sysClock; // Variable for system clock  
 // some predefined basic colors to use with names 
-enum colors{BLACK=0x00000000,WHITE=0x00FFFFFF,GREY=0x00AAAAAA,RED=0x00FF0000,GREEN=0x0000FF00,BLUE=0x000000FF,YELLOW=0x00FFFF00}; 
+enum colors{BLACK=0x00000000,WHITE=0x00FFFFFF,GREY=0x00AAAAAA,RED=0x00FF0000,GREEN=0x0000FF00,BLUE=0x000000FF,YELLOW=0x00FFFF00,
+            BACKGROUND=0x01000000}; // BACKGROUND: not a color, restores the static layer (bg_mask) below
+
 // same values as array for indexed colors
 int colorarray[]={0x00000000,0x00FFFFFF,0x00AAAAAA,0x00FF0000,0x0000FF00,0x000000FF,0x00FFFF00};
-static bool prev_dir = 0;
+#define NUM_COLORS (sizeof(colorarray) / sizeof(colorarray[0]))
+static bus_rgb_t palette_rgb[NUM_COLORS];  // colorarray as bus triplets, see init_ports_display()
+static int8_t prev_dir = -1;    // -1: nothing drawn yet
 int prev_x1 = 0;
 int prev_y1 = 0;
-static double c_speed = 0; // current speed, displayed on tacho
-static double e_speed = 0;
+static fix16_t c_speed = 0; // current speed, displayed on tacho (km/h)
 static bool iconDrawn = false;
+// Odometer cells: 3 integer + 2 fractional digits, "," and "KM" drawn once
+#define ODO_DIGITS 5
+static const int16_t odo_x[ODO_DIGITS] = {XODO, XODO + 9, XODO + 18, XODO + 35, XODO + 44};
+static int8_t odo_shown[ODO_DIGITS] = {-1, -1, -1, -1, -1};   // digit on screen, -1: none
+static bool odo_static_drawn = false;
+
+// Digital speed readout, ODO_CHAR_HEIGHT tall digits scaled up from digit_tacho
+#define SPD_DIGITS 3
+#define SPD_SCALE (ODO_CHAR_HEIGHT / CHAR_HEIGHT)
+#define XSPD (CENTER_POINT_X - (SPD_DIGITS * (CHAR_WIDTH + 1) - 1) * SPD_SCALE / 2)
+#define YSPD 385
+static int8_t spd_shown[SPD_DIGITS] = {-1, -1, -1};     // digit on screen, -1: none, 10: blank
+#if !USE_RLE_BACKGROUND
+static bool bg_recording = false;   // drawing the static layer: remember its pixels in bg_mask
+#endif
+static uint32_t bus_writes = 0;         // total strobes since boot
+static uint32_t needle_bus_writes = 0;  // strobes of the last needle update, all its slices
+// Controller state cache: window registers and write pointer as last sent to the SSD1963,
+// trusted between display_begin() and display_end() only
+static struct {
+    uint16_t x0, x1, y0, y1;    // column / page window
+    uint32_t written;           // pixels since the last memory write start
+    bool valid;                 // window registers known
+    bool open;                  // no command since the last memory write, data goes on at the write pointer
+} win;
+static uint8_t txn_depth = 0;
+static void restore_hspan(int x0, int x1, int y);
+static void restore_vspan(int x, int y0, int y1);
+
 /********************************************************************************/
 // Pixel map of digits
 /********************************************************************************/
@@ -129,136 +164,196 @@ static const uint8_t char_warning[4][12] = {
 /********************************************************************************
  	 Elementary output functions  => speed optimized as inline
 *********************************************************************************/
-inline void write_command(unsigned char command)
-{ 	GPIO_PORTM_DATA_R = command;        // Write command byte
-    GPIO_PORTL_DATA_R = 0x11;           // Chip select = 0, Command mode select = 0, Write state = 0
-    GPIO_PORTL_DATA_R = 0x1F;           // Initial state
+static inline void write_command(unsigned char command)
+{ 	bus_write_command(command);
+    BUS_COUNT();
+    win.open = false;           // any command ends a running memory write
+}
+/********************************************************************************/
+static inline void write_data(unsigned char data)
+{ 	bus_write_data(data);
+    BUS_COUNT();
+}
+/********************************************************************************/
+static inline void window_set(uint32_t min_x, uint32_t min_y, uint32_t max_x, uint32_t max_y)
+{
+    // inside a transaction only the registers that differ from the cached window are sent
+    if (!txn_depth || !win.valid || min_x != win.x0 || max_x != win.x1) {
+        write_command(0x2A);           // Set row address x-axis
+        write_data(min_x >> 8);        // Set start  address           (high byte)
+        write_data(min_x);             // as above                     (low byte)
+        write_data(max_x >> 8);        // Set stop address             (high byte)
+        write_data(max_x);             // as above                     (low byte) 
+    }
+    if (!txn_depth || !win.valid || min_y != win.y0 || max_y != win.y1) {
+        write_command(0x2B);             // Set column address (y-axis)
+        write_data(min_y >> 8);        // Set start column address     (high byte)
+        write_data(min_y);             // as above                     (low byte)
+        write_data(max_y >> 8);        // Set stop column address      (high byte)
+        write_data(max_y);             // as above                     (low byte)
+    }
+    win.x0 = min_x;
+    win.x1 = max_x;
+    win.y0 = min_y;
+    win.y1 = max_y;
+    win.valid = true;
+}
+/********************************************************************************/
+// Start a memory write for the window min..max, pixel data follows. A single row is opened
+// up to the right screen edge: a span that starts where the last one ended on the same row
+// then goes on as plain pixel data, without any command.
+static void mem_write(uint32_t min_x, uint32_t min_y, uint32_t max_x, uint32_t max_y)
+{
+    if (txn_depth && win.open && min_y == max_y && win.y0 == min_y && win.y1 == min_y
+        && min_x == win.x0 + win.written && max_x <= win.x1) {
+        return;
+    }
+    if (min_y == max_y) max_x = MAX_X - 1;
+    window_set(min_x, min_y, max_x, max_y);
+    write_command(0x2C);            // Memory write, from the window origin
+    win.written = 0;
+    win.open = true;
+}
+/********************************************************************************/
+// Transaction: the display layer alone drives the bus until the matching display_end(),
+// so the window cache can elide redundant commands. Calls may nest.
+void display_begin(void)
+{
+    if (txn_depth++ == 0) win.valid = false;    // bus may have been used by someone else
+}
+
+void display_end(void)
+{
+    if (txn_depth) txn_depth--;
 }
 /********************************************************************************/
-inline void write_data(unsigned char data)
-{ 	GPIO_PORTM_DATA_R = data;           // Write data byte
-    GPIO_PORTL_DATA_R = 0x15;           // Chip select = 0, Write state = 0
-    GPIO_PORTL_DATA_R = 0x1F;           // Initial state
+// Stream n pixels of one color into the current window, after a memory write command
+static inline void write_pixels(uint32_t color, uint32_t n)
+{
+    bus_rgb_t c = bus_rgb(color);
+    bus_fill(&c, n);
+    BUS_ADD(3 * n);
+    win.written += n;
 }
 /********************************************************************************/
-inline void window_set(min_x, min_y, max_x, max_y)
+// Stream n pixels from a buffer of precomputed triplets, one pointer per pixel
+static inline void write_stream(const bus_rgb_t *const *pixels, uint32_t n)
+{
+    bus_stream(pixels, n);
+    BUS_ADD(3 * n);
+    win.written += n;
+}
+// Stream n pixels of colorarray[index], triplet from the palette table
+static inline void write_palette(uint8_t index, uint32_t n)
 {
-    write_command(0x2A);           // Set row address x-axis
-    write_data(min_x >> 8);        // Set start  address           (high byte)
-    write_data(min_x);             // as above                     (low byte)
-    write_data(max_x >> 8);        // Set stop address             (high byte)
-    write_data(max_x);             // as above                     (low byte) 
-    write_command(0x2B);             // Set column address (y-axis)
-    write_data(min_y >> 8);        // Set start column address     (high byte)
-    write_data(min_y);             // as above                     (low byte)
-    write_data(max_y >> 8);        // Set stop column address      (high byte)
-    write_data(max_y);             // as above                     (low byte)
+    bus_fill(&palette_rgb[index], n);
+    BUS_ADD(3 * n);
+    win.written += n;
 }
 /********************************************************************************/
 void init_ports_display(void)
 {
-	// Set Port M Pins 0-7: used as Output of LCD Data
-	SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOM);            // enable clock-gate Port M
-	while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOM));     // wait until clock ready
-	GPIOPinTypeGPIOOutput(GPIO_PORTM_BASE, 0xFF);
-	// Set Port L Pins 0-4: used as Output of LCD Control signals:
-	SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOL);            // Clock Port L
-	while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOL));
-	GPIOPinTypeGPIOOutput(GPIO_PORTL_BASE, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3| GPIO_PIN_4);
+    uint32_t i;
+    bus_init();     // Port M: LCD data, Port L: LCD control signals
+    for (i = 0; i < NUM_COLORS; i++) palette_rgb[i] = bus_rgb(colorarray[i]);
 }
 
-void configure_display_controller_large (void) // 800 x 480 pixel 
+/********************************************************************************/
+// Controller bring-up as a table of steps, waits run on a timer (bus_wait_start)
+// so the main loop keeps serving the measurement meanwhile
+/********************************************************************************/
+#define INIT_RESET_ON 0x100     // pseudo commands: hardware reset line
+#define INIT_RESET_OFF 0x101
+
+typedef struct {
+    uint16_t command;
+    uint8_t num_data;
+    uint8_t data[8];
+    uint16_t wait_us;       // after this step
+} init_step_t;
+
+static const init_step_t init_steps[] = {
+    {INIT_RESET_ON, 0, {0}, 1000},                  // Hardware reset, wait >1 ms
+    {INIT_RESET_OFF, 0, {0}, 1000},                 // wait >1 ms
+    {SOFTWARE_RESET, 0, {0}, 10000},                // Software reset, wait >10 ms
+    {SET_PLL_MN, 3, {0x24, 0x02, 0x04}, 0},         // Set PLL Freq to 120 MHz
+    {START_PLL, 1, {0x01}, 1000},                   // Start PLL, wait 1 ms
+    {LOCK_PLL, 1, {0x03}, 1000},                    // Lock PLL, wait 1 ms
+    {SOFTWARE_RESET, 0, {0}, 10000},                // Software reset, wait 10 ms
+    {0xE6, 3, {0x01, 0x70, 0xA3}, 0},               // Set pixel clock frequency: KRR Set LCD Pixel Clock 9MHz
+    // SET LCD MODE SIZE, manual p. 44: TFT panel 24bit, TFT mode, horizontal size = 800-1,
+    // vertical size = 480-1, even line RGB sequence / odd line RGB sequence RGB
+    {SET_LCD_MODE, 7, {0x20, 0x00, 0x03, 0x1F, 0x01, 0xDF, 0x00}, 0},
+    // Set Horizontal Period: total period 0x35E, non-display period 0x46 between the start of
+    // the horizontal sync (LLINE) signal and the first display data, sync width 9, sync pulse start 8
+    {SET_HORI_PERIOD, 8, {0x03, 0x5E, 0x00, 0x46, 0x09, 0x00, 0x08, 0x00}, 0},
+    // Set vertical periods, manual p. 49: total 510 lines, 12 lines before the first display data,
+    // vertical sync width = 10 pixels, sync pulse start position 4 lines
+    {SET_VERT_PERIOD, 7, {0x01, 0xFE, 0x00, 0x0C, 0x0A, 0x00, 0x04}, 0},
+    {SET_ADRESS_MODE, 1, {0x03}, 0},                // Pixel address counting = flip display, manual p. 36, matches touch screen addressing
+//  {0x0A, 1, {0x1C}, 0},                           // Power control mode not tested in detail
+    {SET_PIXEL_DATA_FORMAT, 1, {0x00}, 0},          // set pixel data format 8bit manual p. 78
+    {SET_DISPLAY_ON, 0, {0}, 0},                    // Set display on  manual p. 78
+};
+#define NUM_INIT_STEPS (sizeof(init_steps) / sizeof(init_steps[0]))
+
+static uint8_t init_step = NUM_INIT_STEPS;  // next step, NUM_INIT_STEPS: idle or done
+
+void display_init_start(void)
+{
+    init_step = 0;
+    win.valid = false;
+}
+
+// Runs the steps up to the next wait, true once the controller is configured
+bool display_init_poll(void)
 {
-//////////////////////////////////////////////////////////////////////////////////
-    GPIO_PORTL_DATA_R = INITIAL_STATE;      // Initial state
-    GPIO_PORTL_DATA_R &= ~RST;              // Hardware reset
-    SysCtlDelay(10000);                     // wait >1 ms
-    GPIO_PORTL_DATA_R |= RST;               //
-    SysCtlDelay(12000);                     // wait >1 ms
-
-    write_command(SOFTWARE_RESET);          // Software reset
-    SysCtlDelay(120000);                    // wait >10 ms
-
-    write_command(SET_PLL_MN);               // Set PLL Freq to 120 MHz
-    write_data(0x24);                        //
-    write_data(0x02);                        //
-    write_data(0x04);                        //
-
-    write_command(START_PLL);                // Start PLL
-    write_data(0x01);                        //
-    SysCtlDelay(10000);                      // wait 1 ms
-
-    write_command(START_PLL);                // Lock PLL
-    write_data(0x03);                        //
-    SysCtlDelay(10000);                      // wait 1 ms
-
-    write_command(SOFTWARE_RESET);           // Software reset
-    SysCtlDelay(100000);                     // wait 10 ms
-
-    write_command(0xe6);                    // Set pixel clock frequency
-    write_data(0x01);                       // KRR Set LCD Pixel Clock 9MHz
-    write_data(0x70);                       // KRR
-    write_data(0xA3);                       // KRR
-
-    write_command(SET_LCD_MODE);          // SET LCD MODE SIZE, manual p. 44
-    write_data(0x20);                     // ..TFT panel 24bit
-    write_data(0x00);                     // ..TFT mode
-    write_data(0x03);                     // SET horizontal size = 800-1 (high byte)
-    write_data(0x1F);                     // SET horizontal size = 800-1 (low byte)
-    write_data(0x01);                     // Set vertical size = 480-1 (high byte)
-    write_data(0xDF);                     // Set vertical size = 480-1 (low byte)
-    write_data(0x00);                     // Even line RGB sequence / Odd line RGB sequence RGB
-
-    write_command(SET_HORI_PERIOD);       // Set Horizontal Period
-    write_data(0x03);                     // Horizontal total period (display + non-displayed)  (high byte)
-    write_data(0x5E);                     // Horizontal total period (display + non-display) (low byte)
-    write_data(0x00);                     // Non-displayed period between the start of the horizontal sync (LLINE) signal and the first displayed data.
-    write_data(0x46);                     // Low byte of the non-display period between the start of the horizontal sync (LLINE) signal and the first display data
-    write_data(0x09);                     // Set the vertical sync width
-    write_data(0x00);                     // Set horiz.Sync pulse start    (high byte)
-    write_data(0x08);                     // Set horiz.Sync pulse start    (low byte)
-    write_data(0x00);                     //
-
-    write_command(SET_VERT_PERIOD);         // Set vertical periods, manual  p. 49
-    write_data(0x01);                       // Vertical total period (display + non-displayed) in lines (high byte)
-    write_data(0xFE);                       // as above (low byte) = total 510  lines
-    write_data(0x00);                       //
-    write_data(0x0C);                       // The non-displayed period in lines between the start of the frame and the first
-                                            // display data = 12 line.s
-    write_data(0x0A);                       // Set the vertiacla sync width = 10 pixels
-    write_data(0x00);                       // Set vertical sync pulse start position (high byte)
-    write_data(0x04);                       // as above (low byte) = total sync pulse start position is 4 lines
-
-    write_command(SET_ADRESS_MODE);         // Pixel address counting = flip display , manual p. 36
-    write_data(0x03);                       // necessary to match with touch screen addressing
-
-//  write_command(0x0A);                    // Power control mode not tested in detail
-//  write_data(0x1C);
-
-    write_command(SET_PIXEL_DATA_FORMAT);    // set pixel data format 8bit manual p. 78
-    write_data(0x00);
-
-    write_command(SET_DISPLAY_ON);           // Set display on  manual p. 78
+    while (init_step < NUM_INIT_STEPS) {
+        const init_step_t *step = &init_steps[init_step];
+        uint32_t i;
+
+        if (!bus_wait_done()) return false;
+
+        if (step->command == INIT_RESET_ON) bus_reset(true);
+        else if (step->command == INIT_RESET_OFF) bus_reset(false);
+        else {
+            write_command(step->command);
+            for (i = 0; i < step->num_data; i++) write_data(step->data[i]);
+        }
+        init_step++;
+        if (step->wait_us) bus_wait_start(step->wait_us);
+    }
+    return bus_wait_done();
 }
 
 
+/********************************************************************************/
+#if USE_SHADOW_FB
+// Palette index of a color in colorarray, unknown colors map to BLACK
+static uint8_t color_index(uint32_t color) {
+    uint8_t i;
+    for (i = 0; i < NUM_COLORS; i++) {
+        if ((uint32_t)colorarray[i] == color) return i;
+    }
+    return 0;
+}
+#endif
+
 /********************************************************************************/
 // Fill a rectangle with a single color and defined w&h with respect to starting coordinates 
 void fill_rect(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t color) {
-    uint32_t i;
     uint32_t total_pixels;
     
     if (width == 0 || height == 0) return; // nothing to do
+#if USE_SHADOW_FB
+    fb_fill_rect(x, y, width, height, color_index(color));
+    return;
+#endif
     total_pixels = width * height;
 
     // set the window to the whole rectangle
-    window_set(x, y, x + width - 1, y + height - 1);
-    write_command(0x2C); // Memory write
-    for (i = 0; i < total_pixels; i++) {
-        write_data((color >> 16) & 0xFF); // R
-        write_data((color >> 8) & 0xFF);  // G
-        write_data(color & 0xFF);         // B
-    }
+    mem_write(x, y, x + width - 1, y + height - 1);
+    write_pixels(color, total_pixels);
 }
 /*
 // same as fillrect(), but with defined end pixel coordinate
@@ -282,143 +377,263 @@ void draw_pixels(uint32_t min_x, uint32_t min_y, uint32_t max_x, uint32_t max_y,
 
 // 1x1 window size
 void draw_pixel_single(uint32_t x, uint32_t y, uint32_t color) {
-    window_set(x, y, x, y); 
-    write_command(0x2C);      // memory write
-    write_data((color>>16)&0xFF);
-    write_data((color>>8)&0xFF);
-    write_data(color&0xFF);
+    if (color == BACKGROUND) { restore_hspan(x, x, y); return; }
+#if !USE_RLE_BACKGROUND
+    if (bg_recording && color != BLACK) bg_mask_set(x, y);
+#endif
+#if USE_SHADOW_FB
+    fb_set_pixel(x, y, color_index(color));
+    return;
+#endif
+    mem_write(x, y, x, y);
+    write_pixels(color, 1);
 }
 
-// Needle gauge
-/*
-void draw_needle_gauge(uint32_t speed){
-    uint32_t this_needle;
+// Restore a horizontal run from the static background description, one window for the run
+#if USE_RLE_BACKGROUND
+// First run of row y that contains column x, *run_x0 is where that run starts
+static const uint16_t *dial_run(int x, int y, int *run_x0) {
+    const uint16_t *run = &dial_rle[dial_rle_row[y]];
+    int rx = 0;
+    while (rx + DIAL_RLE_LEN(*run) <= x) rx += DIAL_RLE_LEN(*run++);
+    *run_x0 = rx;
+    return run;
+}
 
-    // Find position of the needle w.R.t gauge width
-    speed = speed /100; // Watch out: Speed is in factor of 100 here
-    if (speed>MAX_SPEED) speed = MAX_SPEED;
-    this_needle = (speed * GAUGE_WIDTH) / MAX_SPEED;
+// Background pixels straight from the dial runs, clipped to x0..x1
+static void restore_hspan(int x0, int x1, int y) {
+    int rx;
+    const uint16_t *run = dial_run(x0, y, &rx);
+#if !USE_SHADOW_FB
+    mem_write(x0, y, x1, y);
+#endif
+    while (x0 <= x1) {
+        int end = rx + DIAL_RLE_LEN(*run) - 1;
+        if (end > x1) end = x1;
+#if USE_SHADOW_FB
+        fb_hspan(x0, end, y, DIAL_RLE_INDEX(*run));
+#else
+        write_palette(DIAL_RLE_INDEX(*run), end - x0 + 1);
+#endif
+        rx += DIAL_RLE_LEN(*run++);
+        x0 = end + 1;
+    }
+}
 
-    // Clear previous needle position only if position has changed!
-    if (prev_needle != this_needle)
-        draw_pixels(prev_needle, GAUGE_HEIGHT, prev_needle, GAUGE_HEIGHT+NEEDLE_HEIGHT-1, BLACK);
+static void restore_vspan(int x, int y0, int y1) {
+    int y, rx;
+#if USE_SHADOW_FB
+    for (y = y0; y <= y1; y++) fb_set_pixel(x, y, DIAL_RLE_INDEX(*dial_run(x, y, &rx)));
+    return;
+#endif
+    mem_write(x, y0, x, y1);
+    for (y = y0; y <= y1; y++) write_palette(DIAL_RLE_INDEX(*dial_run(x, y, &rx)), 1);
+}
 
-    
-    // THEN draw the current needle  
-    draw_pixels(this_needle, GAUGE_HEIGHT, this_needle, GAUGE_HEIGHT+NEEDLE_HEIGHT-1, RED);
-    
-    prev_needle = this_needle; // save current needle position
+// Row y of the dial, into the window opened by reset_background_step()
+static void dial_row(int y) {
+    uint32_t i;
+#if USE_SHADOW_FB
+    int x = 0;
+    for (i = dial_rle_row[y]; i < dial_rle_row[y + 1]; i++) {
+        int len = DIAL_RLE_LEN(dial_rle[i]);
+        fb_hspan(x, x + len - 1, y, DIAL_RLE_INDEX(dial_rle[i]));
+        x += len;
+    }
+    return;
+#endif
+    for (i = dial_rle_row[y]; i < dial_rle_row[y + 1]; i++) write_palette(DIAL_RLE_INDEX(dial_rle[i]), DIAL_RLE_LEN(dial_rle[i]));
+}
+#else
+static void restore_hspan(int x0, int x1, int y) {
+    int x;
+#if USE_SHADOW_FB
+    for (x = x0; x <= x1; x++) fb_set_pixel(x, y, color_index(bg_color(x, y)));
+    return;
+#endif
+    mem_write(x0, y, x1, y);
+    for (x = x0; x <= x1; x++) write_pixels(bg_color(x, y), 1);
 }
-*/
 
-// Draw a single digit 
-void draw_digit_tacho(int digit, int x, int y, uint32_t color) {
-    if (digit < 0 || digit > 9) return;
-    int row=0;
-    int col=0;
-    // draw row by row of digit bitmap
-    for ( row = 0; row < CHAR_HEIGHT; row++) {
-        uint8_t bits = digit_tacho[digit][row];
-        for ( col = 0; col < CHAR_WIDTH; col++) {
-            if (bits & (1 << (7 - col))) {
-                draw_pixel_single(x + col, y + row, color);
-            }
+// Same for a vertical run
+static void restore_vspan(int x, int y0, int y1) {
+    int y;
+#if USE_SHADOW_FB
+    for (y = y0; y <= y1; y++) fb_set_pixel(x, y, color_index(bg_color(x, y)));
+    return;
+#endif
+    mem_write(x, y0, x, y1);
+    for (y = y0; y <= y1; y++) write_pixels(bg_color(x, y), 1);
+}
+#endif
+
+// Whole 8x12 glyph cell as one window, set bits in fg and all others in bg (opaque)
+void blit_glyph(const uint8_t bitmap[CHAR_HEIGHT], int x, int y, uint32_t fg, uint32_t bg) {
+    int row, col;
+#if !USE_RLE_BACKGROUND
+    if (bg_recording && fg != BLACK) {
+        for (row = 0; row < CHAR_HEIGHT; row++)
+            for (col = 0; col < CHAR_WIDTH; col++)
+                if (bitmap[row] & (0x80 >> col)) bg_mask_set(x + col, y + row);
+        bg_mask_add_region(x, y, CHAR_WIDTH, CHAR_HEIGHT, fg);
+    }
+#endif
+#if USE_SHADOW_FB
+    uint8_t fg_i = color_index(fg), bg_i = color_index(bg);
+    for (row = 0; row < CHAR_HEIGHT; row++) {
+        for (col = 0; col < CHAR_WIDTH; col++) {
+            fb_set_pixel(x + col, y + row, (bitmap[row] & (0x80 >> col)) ? fg_i : bg_i);
+        }
+    }
+    return;
+#endif
+    bus_rgb_t fg_c = bus_rgb(fg), bg_c = bus_rgb(bg);
+    const bus_rgb_t *cell[CHAR_WIDTH * CHAR_HEIGHT];
+
+    // 96 pixels in one burst, row by row of the bitmap
+    for (row = 0; row < CHAR_HEIGHT; row++) {
+        uint8_t bits = bitmap[row];
+        for (col = 0; col < CHAR_WIDTH; col++) {
+            cell[row * CHAR_WIDTH + col] = (bits & 0x80) ? &fg_c : &bg_c;
+            bits <<= 1;
         }
     }
+    mem_write(x, y, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
+    write_stream(cell, CHAR_WIDTH * CHAR_HEIGHT);
 }
 
-// Draw the ticks and speed number on the tachometer gauge
-/*
-void draw_gauge_ticks(void) {
-    const int step = 20; // each step equals to 10 km/h
-    int value = 0;
-    int j = 0;
-    int x = 0;
-
-    // draw along the whole width of the display
-    for (value = 0; value < MAX_X; value += step) {
-        x = value; // start from edge 
-        
-        if (value%50 == 0 || value == 0  ){ // draw large tick
-            for (j = 0; j < TICK_HEIGHT*3; j++) {
-                draw_pixel_single(x, MAX_Y - TICK_HEIGHT*3 - SPEED_CHAR_HEIGHT*2 + j, WHITE);
-            }
-            // show number under large ticks
-            // display the speed numbers below the ticks
-            draw_number_tacho(value/2,x,(int)MAX_Y - TICK_HEIGHT*3-SPEED_CHAR_HEIGHT,WHITE);
+// 8x12 glyph magnified by an integer scale, each bitmap row is split into runs of equal
+// color and every run goes out as one burst of run * scale pixels. Opaque: the whole
+// (8 * scale) x (12 * scale) cell is one window, no clear beforehand.
+void blit_glyph_scaled(const uint8_t bitmap[CHAR_HEIGHT], int x, int y, int scale, uint32_t fg, uint32_t bg) {
+    int row, rep, col, run;
+#if !USE_RLE_BACKGROUND
+    if (bg_recording && fg != BLACK) {
+        for (row = 0; row < CHAR_HEIGHT * scale; row++)
+            for (col = 0; col < CHAR_WIDTH * scale; col++)
+                if (bitmap[row / scale] & (0x80 >> (col / scale))) bg_mask_set(x + col, y + row);
+        bg_mask_add_region(x, y, CHAR_WIDTH * scale, CHAR_HEIGHT * scale, fg);
+    }
+#endif
+#if USE_SHADOW_FB
+    uint8_t fg_i = color_index(fg), bg_i = color_index(bg);
+    for (row = 0; row < CHAR_HEIGHT * scale; row++) {
+        uint8_t bits = bitmap[row / scale];
+        for (col = 0; col < CHAR_WIDTH; col += run) {
+            bool set = bits & (0x80 >> col);
+            for (run = 1; col + run < CHAR_WIDTH && (bool)(bits & (0x80 >> (col + run))) == set; run++);
+            fb_hspan(x + col * scale, x + (col + run) * scale - 1, y + row, set ? fg_i : bg_i);
         }
-        else {  // small ticks
-            for (j = 0; j < TICK_HEIGHT; j++) {
-                draw_pixel_single(x, MAX_Y - TICK_HEIGHT - SPEED_CHAR_HEIGHT*2 + j, WHITE);
+    }
+    return;
+#endif
+    mem_write(x, y, x + CHAR_WIDTH * scale - 1, y + CHAR_HEIGHT * scale - 1);
+    for (row = 0; row < CHAR_HEIGHT; row++) {
+        uint8_t bits = bitmap[row];
+        for (rep = 0; rep < scale; rep++) {
+            for (col = 0; col < CHAR_WIDTH; col += run) {
+                bool set = bits & (0x80 >> col);
+                for (run = 1; col + run < CHAR_WIDTH && (bool)(bits & (0x80 >> (col + run))) == set; run++);
+                write_pixels(set ? fg : bg, run * scale);
             }
         }
     }
+}
 
-    // draw last tick for 400kmh
-    for (j = 0; j < TICK_HEIGHT*3; j++)
-        draw_pixel_single(MAX_X-1, MAX_Y - TICK_HEIGHT*3 - SPEED_CHAR_HEIGHT*2 + j, WHITE);
-    draw_number_tacho(value/2,x-10,(int)MAX_Y - TICK_HEIGHT*3-SPEED_CHAR_HEIGHT,WHITE); // 30 == length of numbers
-
+// Horizontal run from x0 to x1 (any order) on row y as one window + pixel burst
+void draw_hspan(int x0, int x1, int y, uint32_t color) {
+    if (x0 > x1) { int t = x0; x0 = x1; x1 = t; }
+    if (color == BACKGROUND) { restore_hspan(x0, x1, y); return; }
+#if !USE_RLE_BACKGROUND
+    if (bg_recording && color != BLACK) { int x; for (x = x0; x <= x1; x++) bg_mask_set(x, y); }
+#endif
+#if USE_SHADOW_FB
+    fb_hspan(x0, x1, y, color_index(color));
+    return;
+#endif
+    mem_write(x0, y, x1, y);
+    write_pixels(color, x1 - x0 + 1);
 }
-*/
 
-// --- ODOMETER ---
-void draw_char(const uint8_t myarray[][12],int index, int x, int y, uint32_t color) {
-    int row=0;
-    int col=0;
-    // draw row by row of digit bitmap
-    for ( row = 0; row < 12; row++) {
-        uint8_t bits = myarray[index][row];
-        for ( col = 0; col < 8; col++) {
-            if (bits & (1 << (7 - col))) {
-                draw_pixel_single(x + col, y + row, color);
-            }
-        }
-    }
+// Vertical run from y0 to y1 (any order) in column x as one window + pixel burst
+void draw_vspan(int x, int y0, int y1, uint32_t color) {
+    if (y0 > y1) { int t = y0; y0 = y1; y1 = t; }
+    if (color == BACKGROUND) { restore_vspan(x, y0, y1); return; }
+#if !USE_RLE_BACKGROUND
+    if (bg_recording && color != BLACK) { int y; for (y = y0; y <= y1; y++) bg_mask_set(x, y); }
+#endif
+#if USE_SHADOW_FB
+    uint8_t index = color_index(color);
+    for (; y0 <= y1; y0++) fb_set_pixel(x, y0, index);
+    return;
+#endif
+    mem_write(x, y0, x, y1);
+    write_pixels(color, y1 - y0 + 1);
 }
 
-void draw_odometer(float distance){
-    int distance_int = (int)distance;
-    int distance_frac = (int)((distance-distance_int) *100); // 2 d.p.
 
-    char int_buf[4];
-    char frac_buf[3];
+// Draw a single digit 
+void draw_digit_tacho(int digit, int x, int y, uint32_t color) {
+    if (digit < 0 || digit > 9) return;
+    blit_glyph(digit_tacho[digit], x, y, color, BLACK);
+}
 
-    snprintf(int_buf, sizeof(int_buf), "%03d", distance_int);
-    snprintf(frac_buf, sizeof(frac_buf), "%02d", distance_frac);
 
-    int total_width = (strlen(int_buf) + strlen(frac_buf) + 1) * 9; // +1 for comma, 9 for width of char and 1 pixel for spacing
-    fill_rect(XODO, YODO, (uint32_t)total_width, (uint32_t)CHAR_HEIGHT, BLACK); // clear area
+// --- ODOMETER ---
+void draw_char(const uint8_t myarray[][12],int index, int x, int y, uint32_t color) {
+    blit_glyph(myarray[index], x, y, color, BLACK);
+}
 
-    // integer part
-    int cursor = XODO;
+void draw_odometer(uint32_t distance){    // distance in 1/100 km
+    uint32_t value = distance % 100000;     // odometer shows 999,99 km at most
     int i = 0;
     int j = 0;
-    for (i = 0; int_buf[i] != '\0'; i++) {
-        int digit = int_buf[i] - '0';
-        draw_digit_tacho(digit, cursor, YODO, WHITE);
-        cursor += 9; // spacing
+
+    // cells are drawn opaque and only when their digit changed, usually just the last one
+    for (i = ODO_DIGITS - 1; i >= 0; i--) {
+        int digit = value % 10;
+        value /= 10;
+        if (digit != odo_shown[i]) {
+            draw_digit_tacho(digit, odo_x[i], YODO, WHITE);
+            odo_shown[i] = digit;
+        }
     }
 
+    if (odo_static_drawn) return;
+
     // draw comma
     for (j = 0; j < 2; j++) {
-        draw_pixel_single(cursor + 2, YODO + 10 + j, WHITE); // two-pixel comma
+        draw_pixel_single(XODO + 29, YODO + 10 + j, WHITE); // two-pixel comma
     }
-    cursor += 8;
-
-    // fractional part
-    for (i = 0; frac_buf[i] != '\0'; i++) {
-        int digit = frac_buf[i] - '0';
-        draw_digit_tacho(digit, cursor, YODO, WHITE);
-        cursor += 9;
-    }
-    cursor += 8;
     
     // draw km
     for (j=0 ; j <2 ; j++){
-        draw_char(char_kmh, j, cursor, YODO, WHITE);
-        cursor += 9;
+        draw_char(char_kmh, j, XODO + 61 + j * 9, YODO, WHITE);
     }
+    odo_static_drawn = true;
+}
+
+// --- DIGITAL SPEED ---
+static const uint8_t glyph_blank[CHAR_HEIGHT] = {0};
+
+// Speed in km/h as large digits beneath the odometer, leading zeros blanked,
+// only cells whose digit changed are drawn
+bool draw_speed_readout(uint32_t speed){    // speed in 1/100 km/h, false: stopped after a cell, slice used up
+    uint32_t value = speed / 100;
+    int i;
+
+    if (value > 999) value = 999;
+    for (i = SPD_DIGITS - 1; i >= 0; i--) {
+        int digit = (value == 0 && i < SPD_DIGITS - 1) ? 10 : value % 10;   // 10: blank
+        value /= 10;
+        if (digit != spd_shown[i]) {
+            blit_glyph_scaled(digit == 10 ? glyph_blank : digit_tacho[digit],
+                              XSPD + i * (CHAR_WIDTH + 1) * SPD_SCALE, YSPD, SPD_SCALE, WHITE, BLACK);
+            spd_shown[i] = digit;
+            if (widgets_expired()) return false;
+        }
+    }
+    return true;
 }
 
 // --- DIRECTION ---
@@ -439,232 +654,656 @@ void draw_char_dir(int dir_f, int x, int y, uint32_t color) {
 */
 
 void draw_direction(bool directionForwards){
-    // clear if directions different
+    // redraw only if direction differs from what is on screen (opaque cell, no clear needed)
     if(directionForwards != prev_dir){
-        fill_rect(XDIR, YDIR, 20, 20, BLACK);
-        if(directionForwards)   // forwards
-            draw_char(char_dir ,directionForwards, XDIR, YDIR, WHITE);
-        else    // backwards
-            draw_char(char_dir, directionForwards, XDIR, YDIR, WHITE);
+        draw_char(char_dir, directionForwards, XDIR, YDIR, WHITE);
+        prev_dir = directionForwards;
     }
-    prev_dir = directionForwards;
 }
 
 // --- TACHOMETER ---
-/*STANDARD BRESENHAM EQUATION*/
+/*STANDARD BRESENHAM EQUATION, emitting runs instead of single pixels*/
 void bresenham(int x0, int y0, int x1, int y1, uint32_t color)
 {
     int dx =  abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
     int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
     int err = dx + dy, e2; /* error value e_xy */
+    bool shallow = dx >= -dy;   // shallow lines form horizontal runs, steep ones vertical runs
+    int run_x = x0, run_y = y0; // first pixel of the current run
 
     while (1) {
-        draw_pixel_single(x0, y0,color);
         if (x0 == x1 && y0 == y1) break;    /*reached last pixel coord*/
         e2 = 2 * err;
         if (e2 > dy) { err += dy; x0 += sx; } /* e_xy+e_x > 0 */
         if (e2 < dx) { err += dx; y0 += sy; } /* e_xy+e_y < 0 */
+
+        // run ends as soon as the minor axis steps, flush everything up to the previous pixel
+        if (shallow && y0 != run_y) {
+            draw_hspan(run_x, x0 - sx, run_y, color);
+            run_x = x0;
+            run_y = y0;
+        } else if (!shallow && x0 != run_x) {
+            draw_vspan(run_x, run_y, y0 - sy, color);
+            run_x = x0;
+            run_y = y0;
+        }
     }
+
+    // last run up to the end point
+    if (shallow) draw_hspan(run_x, x1, run_y, color);
+    else draw_vspan(run_x, run_y, y1, color);
 }
 
-// draw outside border arc 
-void rasterArc(int x0, int y0, int radius)
+// Integer square root, floor
+static uint32_t isqrt(uint32_t v)
 {
-    int f = 1 - radius;
-    int ddF_x = 0;
-    int ddF_y = -2 * radius;
-    int x = 0;
-    int y = radius;
-
-    draw_pixel_single(x0, y0 + radius,YELLOW);  // Top
-    //draw_pixel_single(x0, y0 - radius,YELLOW);  // Bottom
-    draw_pixel_single(x0 + radius, y0,YELLOW);  // Left
-    draw_pixel_single(x0 - radius, y0,YELLOW);  // Right
-
-    while(x < y)
-    {
-        if (f >= 0)
-        {
-            y -= 1;
-            ddF_y += 2;
-            f += ddF_y;
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
         }
-        x += 1;
-        ddF_x += 2;
-        f += ddF_x + 1;
+        bit >>= 2;
+    }
+    return root;
+}
 
-        //draw_pixel_single(x0 + x, y0 + y,YELLOW);   // Bottom-right
-        //draw_pixel_single(x0 - x, y0 + y,YELLOW);   // Bottom-left
-        draw_pixel_single(x0 + x, y0 - y,YELLOW);   // Top-right
-        draw_pixel_single(x0 - x, y0 - y,YELLOW);   // Top-left
-        draw_pixel_single(x0 + y, y0 + x,YELLOW);   // Right-bottom
-        draw_pixel_single(x0 - y, y0 + x,YELLOW);   // Left-bottom
-        draw_pixel_single(x0 + y, y0 - x,YELLOW);   // Right-top
-        draw_pixel_single(x0 - y, y0 - x,YELLOW);   // Left-top
+// Bound of the half plane k * dx <= m on one row: lo <= dx <= hi
+static void half_plane(fix16_t k, fix16_t m, int *lo, int *hi)
+{
+    if (k > 0) {
+        int bound = m >= 0 ? m / k : -((-m + k - 1) / k);     // floor(m / k)
+        if (bound < *hi) *hi = bound;
+    } else if (k < 0) {
+        int bound = m <= 0 ? (-m + (-k) - 1) / (-k) : -(m / (-k));     // ceil(m / k)
+        if (bound > *lo) *lo = bound;
+    } else if (m < 0) {
+        *lo = 1; *hi = 0;   // whole row outside
     }
 }
 
-void bresenham_needle(int x0, int y0, uint32_t t_speed){
-    if (t_speed == 0) e_speed = - c_speed;      // e_speed = error speed : show difference of target and current shown speed
-    else e_speed = t_speed - c_speed;   // t_speed = target speed
-    
-    if (fabs(e_speed) < 1.0) { // small difference, speed jumps
-        c_speed = t_speed; 
-    } else {
-        c_speed += (e_speed * S_FACTOR); 
+// Convex annular sector (sweep up to half a turn), rows y_first..y_last only
+static void arc_band_rows(int x0, int y0, int r_in, int r_out, fix16_t a_start, fix16_t a_end,
+                          uint32_t color, int y_first, int y_last)
+{
+    // edge directions, math orientation (y up), angles in turns counterclockwise
+    fix16_t cs = fix16_cos_turns(a_start), ss = fix16_sin_turns(a_start);
+    fix16_t ce = fix16_cos_turns(a_end), se = fix16_sin_turns(a_end);
+    int y;
+
+    if (y_first < y0 - r_out) y_first = y0 - r_out;
+    if (y_last > y0 + r_out) y_last = y0 + r_out;
+    for (y = y_first; y <= y_last; y++) {
+        int dy = y - y0;
+        int py = -dy;                       // y up
+        int xo = isqrt(r_out * r_out + r_out - dy * dy);    // +r: rounded radius
+        int xi = (dy * dy < r_in * r_in) ? (int)isqrt(r_in * r_in - r_in - dy * dy) : -1;
+        int lo = -xo, hi = xo;
+
+        // counterclockwise of the start edge: ss*dx <= cs*py, clockwise of the end edge: -se*dx <= -ce*py
+        half_plane(ss, cs * py, &lo, &hi);
+        half_plane(-se, -ce * py, &lo, &hi);
+        if (lo > hi) continue;
+
+        // annulus row is [-xo, -xi - 1] and [xi + 1, xo], each one span
+        if (lo <= -xi - 1) draw_hspan(x0 + lo, x0 + (hi < -xi - 1 ? hi : -xi - 1), y, color);
+        if (hi >= xi + 1) draw_hspan(x0 + (lo > xi + 1 ? lo : xi + 1), x0 + hi, y, color);
     }
-    
-    double this_speed = c_speed /100; // Watch out: Speed is in factor of 100 here
+}
 
-    if (this_speed > MAX_SPEED) this_speed = MAX_SPEED; 
-    int r = NEEDLE_LENGTH;    // length of needle (almost) touching the arc
-    
-    // Find angle to the length of the arc ()
-    double angle = 0.0f;
-    angle = (5.0/4.0)*M_PI - ((this_speed/MAX_SPEED) * (3.0/2.0)*M_PI); // adjust to 270 deg or 3/2*M_PI
-    int x1 = x0 + (int) r * cos(angle);
-    int y1 = y0 - (int) r * sin(angle);
-    
-    // Clear previous needle pixel position if changed
-    if (prev_x1 != x1 || prev_y1 != y1)
-        bresenham(x0,  y0,  prev_x1,  prev_y1, BLACK);
-    
-    // Draw new needle 
-    bresenham(x0,  y0,  x1,  y1, YELLOW);
- 
-    // save old needle position
-    prev_x1 = x1;
-    prev_y1 = y1;
+// Annular sector between r_in and r_out from a_start counterclockwise to a_end (turns),
+// filled row by row with one span per row and side, rows outside y_first..y_last are skipped
+// so a partial repair only pays for the rows it needs
+void fill_arc_band_rows(int x0, int y0, int r_in, int r_out, fix16_t a_start, fix16_t a_end,
+                        uint32_t color, int y_first, int y_last)
+{
+    // wider sectors are split, every part is convex
+    while (a_end - a_start > FIX16_ONE / 2) {
+        arc_band_rows(x0, y0, r_in, r_out, a_start, a_start + FIX16_ONE / 2, color, y_first, y_last);
+        a_start += FIX16_ONE / 2;
+    }
+    arc_band_rows(x0, y0, r_in, r_out, a_start, a_end, color, y_first, y_last);
+}
+
+void fill_arc_band(int x0, int y0, int r_in, int r_out, fix16_t a_start, fix16_t a_end, uint32_t color)
+{
+    fill_arc_band_rows(x0, y0, r_in, r_out, a_start, a_end, color, 0, MAX_Y - 1);
 }
 
 // Draw a series of digits. x & y are text anchor at top left
 void draw_number_tacho(int number, int x, int y, uint32_t color){
-    char buf[4];
-    snprintf(buf, sizeof(buf), "%d", number); // speed int to string
-
+    int digits[4];
+    int n = 0;
     int i = 0;
+
+    // split into digits, least significant first
+    do {
+        digits[n++] = number % 10;
+        number /= 10;
+    } while (number > 0 && n < 4);
+
     // cycle through the digits
-    while (buf[i] != '\0') {
-        int digit = buf[i] - '0';
-        draw_digit_tacho(digit, x + (i * (CHAR_WIDTH + 1)), y, color); // 8 pixels + 1 pixel spacing
-        i++;
+    for (i = 0; i < n; i++) {
+        draw_digit_tacho(digits[n - 1 - i], x + (i * (CHAR_WIDTH + 1)), y, color); // 8 pixels + 1 pixel spacing
     }
 }
 
-void bresenham_ticks(int x0, int y0){    // at r = 260, short = 5, long = 15 
-    double start_angle = (5.0/4.0) * M_PI;
-    double end_angle = -(1.0/4.0) * M_PI;
+/********************************************************************************/
+// Static gauge layer from the flash tables in gauge_tables.c (gauge_layout.h)
+/********************************************************************************/
+static void draw_kmh_label(void){
+    int j = 0;
+    int cursor = 0;
+    for (j=0 ; j <4 ; j++){
+        draw_char(char_kmh, j, XTSPD + cursor, YTSPD, WHITE);
+        cursor += 9;
+    }
+}
 
+#if GAUGE_STYLE_ARC
+// Radial ticks are diagonal lines
+static void arc_gauge_ticks(void){
     int i;
-    for (i = 0; i <= NUM_TICKS ; i++){
-        // Determine angle 
-        double tick_ratio = (double) i / (double) NUM_TICKS; 
-        double angle = start_angle + tick_ratio * (end_angle - start_angle);
-        
-        // Find start and end coord of tick
-        int x_out = x0 + (int) OUTER_ARC_RAD * cos(angle);
-        int y_out = y0 - (int) OUTER_ARC_RAD * sin(angle);
-
-        int x_in , y_in = 0;
-
-        if( i % 5 == 0 || i == 0) { // long tick
-            x_in = x0 + (int) (OUTER_ARC_RAD-LONG_TICK) * cos(angle);
-            y_in = y0 - (int) (OUTER_ARC_RAD-LONG_TICK) * sin(angle);
-
-            // speed number , only by long ticks
-            int speed_value = i * SPEED_STEP;
-
-            float r_text = OUTER_ARC_RAD - LONG_TICK - 25;   // adjust 25 px inward
-            float px = x0 + r_text * cos(angle);
-            float py = y0 - r_text * sin(angle);
-
-            // Determine coordinate where number spawns
-            float tx , ty  = 0 ;
-
-            if ( angle < M_PI/6 )  
-            {
-                // RIGHT side
-                tx = px - (3) * CHAR_WIDTH;
-                ty = py - CHAR_HEIGHT/2;
-            }
-            else if (angle >= M_PI/6 && angle <= 5*M_PI/6)
-            {
-                // TOP arc
-                tx = px - CHAR_WIDTH;
-                ty = py + CHAR_HEIGHT/4;
-            }
-            else
-            {
-                // LEFT side
-                tx = px + CHAR_WIDTH/4;
-                ty = py - CHAR_HEIGHT/2;
-            }
+    for (i = 0; i < ARC_NUM_TICKS; i++)
+        bresenham(arc_ticks[i].x0, arc_ticks[i].y0, arc_ticks[i].x1, arc_ticks[i].y1, YELLOW);
+    for (i = 0; i < ARC_NUM_LABELS; i++)
+        draw_number_tacho(arc_labels[i].value, arc_labels[i].x, arc_labels[i].y, WHITE);
+}
+#endif
 
-            draw_number_tacho(speed_value, tx,ty,WHITE);
+#if GAUGE_STYLE_LINEAR
+// Vertical ticks, one span each
+static void linear_gauge_ticks(void){
+    int i;
+    for (i = 0; i < LIN_NUM_TICKS_TOTAL; i++)
+        draw_vspan(lin_ticks[i].x0, lin_ticks[i].y0, lin_ticks[i].y1, YELLOW);
+    for (i = 0; i < LIN_NUM_LABELS; i++)
+        draw_number_tacho(lin_labels[i].value, lin_labels[i].x, lin_labels[i].y, WHITE);
+}
+#endif
+
+// engine temperature warning icon after 400km for >30s, repainted only when the flag changes
+void draw_warning(bool warning){
+    int j;
+    if (warning == iconDrawn) return;
+
+    // after cooldown for 15 seconds without movement the icon is painted BLACK again
+    uint32_t color = warning ? RED : BLACK;
+    int xx = XWARN;
+    int yy = YWARN;
+    for(j = 0; j < 2 ; j++){
+        draw_char(char_warning,j, xx, yy,color );
+        xx = xx + 8;
+    }
+    yy = yy + 12;
+    xx = XWARN;
+    for(j = 2; j < 4 ; j++){
+        draw_char(char_warning,j, xx,yy,color );
+        xx = xx + 8;
+    }
+    iconDrawn = warning;
+}
 
-        }
-        else{   // short tick
-            x_in = x0 + (int) (OUTER_ARC_RAD-SHORT_TICK) * cos(angle);
-            y_in = y0 - (int) (OUTER_ARC_RAD-SHORT_TICK) * sin(angle);
-        }
+#if GAUGE_STYLE_ARC
+/********************************************************************************/
+// Filled needle: per row one span of the needle triangle, only the difference
+// between the old and the new spans goes to the display
+/********************************************************************************/
+typedef struct {
+    int16_t y_min, y_max;           // rows in use, empty if y_min > y_max
+    int16_t l[MAX_Y], r[MAX_Y];     // span per row, empty if l > r
+} needle_spans_t;
+
+static needle_spans_t needle_spans[2] = {{1, 0, {0}, {0}}, {1, 0, {0}, {0}}};
+static uint8_t needle_cur = 0;      // needle_spans[needle_cur] is on screen
+static bool needle_drawn = false;   // false until the first needle is on screen
+
+// Edge from p to q: widen the span of every row it crosses
+static void needle_edge(needle_spans_t *s, int px, int py, int qx, int qy){
+    int32_t x, step;
+    int y;
+
+    if (py > qy) { int t = px; px = qx; qx = t; t = py; py = qy; qy = t; }
+    step = py == qy ? 0 : ((int32_t)(qx - px) << 16) / (qy - py);
+    x = (int32_t)px << 16;
+    for (y = py; y <= qy; y++, x += step) {
+        int xr = (x + 0x8000) >> 16;
+        if (y < 0 || y >= MAX_Y) continue;
+        if (xr < s->l[y]) s->l[y] = xr;
+        if (xr > s->r[y]) s->r[y] = xr;
+    }
+    // horizontal edge: both ends on the same row
+    if (py == qy && py >= 0 && py < MAX_Y) {
+        if (qx < s->l[py]) s->l[py] = qx;
+        if (qx > s->r[py]) s->r[py] = qx;
+    }
+}
 
-        bresenham(x_out, y_out, x_in, y_in, YELLOW);
+// Scanline spans of the triangle a, b, t (convex: min/max of the edge crossings per row)
+static void needle_triangle(needle_spans_t *s, int ax, int ay, int bx, int by, int tx, int ty){
+    int y;
+    s->y_min = ay < by ? (ay < ty ? ay : ty) : (by < ty ? by : ty);
+    s->y_max = ay > by ? (ay > ty ? ay : ty) : (by > ty ? by : ty);
+    if (s->y_min < 0) s->y_min = 0;
+    if (s->y_max > MAX_Y - 1) s->y_max = MAX_Y - 1;
+    for (y = s->y_min; y <= s->y_max; y++) {
+        s->l[y] = MAX_X;
+        s->r[y] = -1;
+    }
+    needle_edge(s, ax, ay, bx, by);
+    needle_edge(s, bx, by, tx, ty);
+    needle_edge(s, tx, ty, ax, ay);
+}
 
+// One row: restore what the old span covered alone, draw what the new span covers alone
+static void needle_row_delta(int y, int ol, int or_, int nl, int nr){
+    if (nl > nr) {
+        if (ol <= or_) draw_hspan(ol, or_, y, BACKGROUND);
+        return;
     }
+    if (ol > or_) {
+        draw_hspan(nl, nr, y, YELLOW);
+        return;
+    }
+    if (ol < nl) draw_hspan(ol, or_ < nl - 1 ? or_ : nl - 1, y, BACKGROUND);
+    if (or_ > nr) draw_hspan(ol > nr + 1 ? ol : nr + 1, or_, y, BACKGROUND);
+    if (nl < ol) draw_hspan(nl, nr < ol - 1 ? nr : ol - 1, y, YELLOW);
+    if (nr > or_) draw_hspan(nl > or_ + 1 ? nl : or_ + 1, nr, y, YELLOW);
+}
 
-    // km/h at 90°
-    int j = 0;
-    int cursor = 0;
-    for (j=0 ; j <4 ; j++){
-        draw_char(char_kmh, j, XTSPD + cursor, YTSPD, WHITE);
-        cursor += 9;
+#endif
+
+// Needle position eases towards the target speed, shared by both gauge styles
+static fix16_t needle_smooth(uint32_t t_speed){
+    fix16_t target = ((int64_t)t_speed << 16) / 100;   // Watch out: Speed is in factor of 100 here
+    fix16_t e_speed = fix16_sub(target, c_speed);   // e_speed = error speed : show difference of target and current shown speed
+    
+    if (fix16_abs(e_speed) < S_SNAP) { // small difference, speed jumps
+        c_speed = target; 
+    } else {
+        c_speed = fix16_add(c_speed, fix16_mul(e_speed, S_FACTOR)); 
     }
+    
+    fix16_t this_speed = c_speed;
+    if (this_speed > FIX16_CONST(MAX_SPEED)) this_speed = FIX16_CONST(MAX_SPEED); 
+    if (this_speed < 0) this_speed = 0;
+    return this_speed;
+}
 
-    // engine temperature warning icon after 400km for >30s
-    if(warning_flag){
-        int xx = XWARN;
-        int yy = YWARN;
-        for(j = 0; j < 2 ; j++){
-            draw_char(char_warning,j, xx, yy,RED );
-            xx = xx + 8;
-        }
-        yy = yy + 12;
-        xx = XWARN;
-        for(j = 2; j < 4 ; j++){
-            draw_char(char_warning,j, xx,yy,RED );
-            xx = xx + 8;
-        }
-        iconDrawn = true;
-    } else if (iconDrawn && !warning_flag){ // after cooldown for 15 seconds without movement
-        int xx = XWARN;
-        int yy = YWARN;
-        for(j = 0; j < 2 ; j++){
-            draw_char(char_warning,j, xx, yy,BLACK );
-            xx = xx + 8;
-        }
-        yy = yy + 12;
-        xx = XWARN;
-        for(j = 2; j < 4 ; j++){
-            draw_char(char_warning,j, xx,yy,BLACK );
-            xx = xx + 8;
-        }
-        iconDrawn = false;
+#if GAUGE_STYLE_ARC
+// Rows still to repaint of the running needle update, resumable between slices
+static int16_t needle_row = 0, needle_row_last = -1;
+
+// New needle spans for this_speed, false if the needle did not move
+static bool polygon_needle_begin(int x0, int y0, fix16_t this_speed){
+    // Needle end point from the flash table (host/gen_gauge.c), rounded to the nearest step
+    const needle_point_t *p = &needle_table[fix16_mul_int(this_speed, 100 / NEEDLE_TABLE_STEP)];
+    int x1 = x0 + p->dx;
+    int y1 = y0 + p->dy;
+    
+    // Nothing moved, nothing to do
+    if (needle_drawn && prev_x1 == x1 && prev_y1 == y1) return false;
+
+    // Base corners perpendicular to the needle, NEEDLE_HALF_WIDTH from the center
+    int bx = (-p->dy * NEEDLE_HALF_WIDTH * 2 + (p->dy > 0 ? -NEEDLE_LENGTH : NEEDLE_LENGTH)) / (2 * NEEDLE_LENGTH);
+    int by = (p->dx * NEEDLE_HALF_WIDTH * 2 + (p->dx < 0 ? -NEEDLE_LENGTH : NEEDLE_LENGTH)) / (2 * NEEDLE_LENGTH);
+
+    const needle_spans_t *old = &needle_spans[needle_cur];
+    needle_spans_t *new = &needle_spans[needle_cur ^ 1];
+    needle_triangle(new, x0 + bx, y0 + by, x0 - bx, y0 - by, x1, y1);
+
+    // Rows of both needles, a row outside a needle's range counts as empty span
+    needle_row = old->y_min <= old->y_max && old->y_min < new->y_min ? old->y_min : new->y_min;
+    needle_row_last = old->y_min <= old->y_max && old->y_max > new->y_max ? old->y_max : new->y_max;
+ 
+    // save old needle position
+    prev_x1 = x1;
+    prev_y1 = y1;
+    return true;
+}
+
+// Repaint rows until done (true) or the slice budget is used up (false)
+static bool polygon_needle_rows(void){
+    const needle_spans_t *old = &needle_spans[needle_cur];
+    const needle_spans_t *new = &needle_spans[needle_cur ^ 1];
+
+    while (needle_row <= needle_row_last) {
+        int y = needle_row++;
+        bool in_old = y >= old->y_min && y <= old->y_max;
+        bool in_new = y >= new->y_min && y <= new->y_max;
+        needle_row_delta(y, in_old ? old->l[y] : 1, in_old ? old->r[y] : 0,
+                            in_new ? new->l[y] : 1, in_new ? new->r[y] : 0);
+        if (widgets_expired()) break;
+    }
+    if (needle_row <= needle_row_last) return false;
+
+    needle_cur ^= 1;
+    needle_drawn = true;
+    return true;
+}
+#endif
+
+#if GAUGE_STYLE_LINEAR
+// Vertical bar above the linear scale, old columns restored, new columns drawn
+static int16_t lin_needle_x = -1;      // left column on screen, -1: none
+
+static void linear_needle(fix16_t this_speed){
+    int x = LIN_X + fix16_mul_int(this_speed, LIN_WIDTH) / (int)MAX_SPEED - LIN_NEEDLE_WIDTH / 2;
+    int i;
+
+    if (x == lin_needle_x) return;
+    for (i = 0; i < LIN_NEEDLE_WIDTH; i++) {
+        int old = lin_needle_x + i;
+        if (lin_needle_x >= 0 && (old < x || old >= x + LIN_NEEDLE_WIDTH))
+            draw_vspan(old, LIN_Y - LIN_NEEDLE_HEIGHT, LIN_Y - 1, BACKGROUND);
+    }
+    for (i = 0; i < LIN_NEEDLE_WIDTH; i++) {
+        int new = x + i;
+        if (lin_needle_x < 0 || new < lin_needle_x || new >= lin_needle_x + LIN_NEEDLE_WIDTH)
+            draw_vspan(new, LIN_Y - LIN_NEEDLE_HEIGHT, LIN_Y - 1, RED);
     }
+    lin_needle_x = x;
+}
+#endif
+
+// Whole screen background row by row, resumable: false once the slice is used up (at least
+// one row per call), the next call opens one window from the first row still to go
+static int bg_row = 0;
+
+static bool reset_background_step(void){
+#if !USE_RLE_BACKGROUND
+    if (bg_row == 0) bg_mask_init(BLACK, YELLOW);   // static layer is recorded again by draw_bresenham_ticks() / draw_arc()
+#endif
+#if !USE_SHADOW_FB
+    mem_write(0, bg_row, MAX_X - 1, MAX_Y - 1);
+#endif
+    do {
+#if USE_RLE_BACKGROUND
+        dial_row(bg_row);       // static dial included, nothing left to draw
+#elif USE_SHADOW_FB
+        fb_hspan(0, MAX_X - 1, bg_row, color_index(BLACK));
+#else
+        write_pixels(BLACK, MAX_X);
+#endif
+        if (++bg_row == MAX_Y) {
+            bg_row = 0;
+#if USE_SHADOW_FB
+            fb_invalidate_all();    // panel content is unknown at boot, push everything once
+#endif
+            return true;
+        }
+    } while (!widgets_expired());
+    return false;
 }
 
 /*For call from main*/
-void reset_background(void){  
-    fill_rect(0, 0, MAX_X, MAX_Y, BLACK);
+void reset_background(void){
+    while (!reset_background_step());
 }
 
+// Static dial: bands, ticks, labels and KM/H, recorded into bg_mask
+void draw_static_layer(void){
+    draw_arc();                 // bands first, the ticks go on top
+    draw_bresenham_ticks();
+#if !USE_RLE_BACKGROUND
+    bg_recording = true;        // KM/H is static, the needle passes over it
+#endif
+    draw_kmh_label();
+#if !USE_RLE_BACKGROUND
+    bg_recording = false;
+#endif
+}
+
+#if USE_SHADOW_FB
+static uint32_t flush_ty = 0;   // next tile row of a sliced flush
+
+// Dirty tiles from flush_ty on, true once all rows are out
+static bool flush_rows(void){
+    uint32_t tx, x, y;
+
+    while (flush_ty < FB_TILES_Y) {
+        uint32_t ty = flush_ty++;
+        tx = 0;
+        while (tx < FB_TILES_X) {
+            if (!fb_tile_dirty(tx, ty)) { tx++; continue; }
+
+            // merge neighbouring dirty tiles of this tile row into one window
+            uint32_t first = tx;
+            while (tx < FB_TILES_X && fb_tile_dirty(tx, ty)) tx++;
+
+            uint32_t x0 = first * FB_TILE_SIZE;
+            uint32_t x1 = tx * FB_TILE_SIZE - 1;
+            uint32_t y0 = ty * FB_TILE_SIZE;
+            mem_write(x0, y0, x1, y0 + FB_TILE_SIZE - 1);
+            for (y = y0; y < y0 + FB_TILE_SIZE; y++) {
+                const uint8_t *row = fb_row(y);
+                for (x = x0; x <= x1; x += FB_TILE_SIZE) {    // one tile width per burst
+                    const bus_rgb_t *line[FB_TILE_SIZE];
+                    uint32_t i;
+                    for (i = 0; i < FB_TILE_SIZE; i += 2) {
+                        uint8_t b = row[(x + i) >> 1];
+                        line[i] = &palette_rgb[b >> 4];
+                        line[i + 1] = &palette_rgb[b & 0x0F];
+                    }
+                    write_stream(line, FB_TILE_SIZE);
+                }
+            }
+        }
+        if (widgets_expired() && flush_ty < FB_TILES_Y) return false;
+    }
+    fb_clear_dirty();
+    flush_ty = 0;
+    return true;
+}
+#endif
+
+/*Push all dirty tiles of the shadow framebuffer to the panel, returns number of tiles*/
+uint32_t display_flush(void){
+#if USE_SHADOW_FB
+    uint32_t tiles = fb_dirty_count();
+
+    if (tiles == 0) return 0;
+    display_begin();
+    while (!flush_rows());
+    display_end();
+    return tiles;
+#else
+    return 0;   // drawing goes straight to the panel
+#endif
+}
+
+// Gauge angle of a speed in km/h, turns: 225 deg at 0 down to -45 deg at MAX_SPEED
+#define SPEED_TURNS(v) (FIX16_CONST(ARC_START_TURNS) - (fix16_t)((int64_t)FIX16_CONST(ARC_SWEEP_TURNS) * (v) / (int)MAX_SPEED))
+
+// Border and red zone lie outside the needle sweep (r > NEEDLE_LENGTH), nothing to
+// restore there, so they stay out of the background mask. Draw before the ticks.
 void draw_arc(void){
-    rasterArc(CENTER_POINT_X, CENTER_POINT_Y, OUTER_ARC_RAD);
+#if GAUGE_STYLE_ARC
+    fill_arc_band(CENTER_POINT_X, CENTER_POINT_Y, OUTER_ARC_RAD, OUTER_ARC_RAD + BORDER_WIDTH - 1,
+                  SPEED_TURNS((int)MAX_SPEED), SPEED_TURNS(0), YELLOW);
+    fill_arc_band(CENTER_POINT_X, CENTER_POINT_Y, INNER_ARC_RAD, INNER_ARC_RAD + RED_ZONE_WIDTH - 1,
+                  SPEED_TURNS((int)MAX_SPEED), SPEED_TURNS(RED_ZONE_SPEED), RED);
+#endif
 }
 
-void draw_bresenham(uint32_t speed){
-    bresenham_needle(CENTER_POINT_X, CENTER_POINT_Y, speed);
+// One needle update in slices: false while rows are left for the next call,
+// the target speed is only taken when a new update starts
+static bool needle_busy = false;
+
+static bool needle_step(uint32_t speed){
+    uint32_t bus_start = bus_writes;
+
+    if (!needle_busy) {
+        fix16_t shown = needle_smooth(speed);
+        needle_bus_writes = 0;
+#if GAUGE_STYLE_LINEAR
+        linear_needle(shown);       // two columns at most, never sliced
+#endif
+#if GAUGE_STYLE_ARC
+        needle_busy = polygon_needle_begin(CENTER_POINT_X, CENTER_POINT_Y, shown);
+#else
+        (void)shown;
+#endif
+    }
+#if GAUGE_STYLE_ARC
+    if (needle_busy) needle_busy = !polygon_needle_rows();
+#endif
+    needle_bus_writes += bus_writes - bus_start;
+    return !needle_busy;
 }
 
+// Rasterize the static layer (ticks, numbers) of the selected gauge styles
 void draw_bresenham_ticks(void){
-    bresenham_ticks(CENTER_POINT_X, CENTER_POINT_Y);
+#if !USE_RLE_BACKGROUND
+    bg_recording = true;
+#endif
+#if GAUGE_STYLE_ARC
+    arc_gauge_ticks();
+#endif
+#if GAUGE_STYLE_LINEAR
+    linear_gauge_ticks();
+#endif
+#if !USE_RLE_BACKGROUND
+    bg_recording = false;
+#endif
+}
+
+/*Bus statistics, always 0 when DISPLAY_BUS_STATS is off*/
+uint32_t display_bus_writes(void){
+    return bus_writes;
+}
+
+uint32_t display_needle_bus_writes(void){
+    return needle_bus_writes;
+}
+
+/********************************************************************************/
+// Widgets of the tachometer UI, drawn by one compositor pass per display tick
+/********************************************************************************/
+#define NEEDLE_PERIOD_MS 20     // needle animation every display tick (50 Hz)
+#define ODOMETER_PERIOD_MS 1000 // odometer only needs 1 Hz
+#define SPEED_PERIOD_MS 200     // digital speed at 5 Hz stays readable
+
+static uint32_t ui_speed = 0;       // 1/100 km/h
+static uint32_t ui_distance = 0;    // 1/100 km
+static bool ui_forwards = true;
+static bool ui_warning = false;
+
+#if !USE_RLE_BACKGROUND
+static bool gauge_widget_draw(widget_t *w){
+    (void)w;
+    draw_static_layer();
+    return true;
+}
+#endif
+
+static bool background_widget_draw(widget_t *w){
+    (void)w;
+    return reset_background_step();     // whole screen at boot, in rows
+}
+
+static bool needle_widget_draw(widget_t *w){
+    (void)w;
+    return needle_step(ui_speed);   // rows of the needle, resumable
+}
+
+static bool odometer_widget_draw(widget_t *w){
+    (void)w;
+    draw_odometer(ui_distance);
+    return true;
+}
+
+static bool speed_widget_draw(widget_t *w){
+    (void)w;
+    return draw_speed_readout(ui_speed);    // one glyph at a time
+}
+
+static bool direction_widget_draw(widget_t *w){
+    (void)w;
+    draw_direction(ui_forwards);
+    return true;
+}
+
+static bool warning_widget_draw(widget_t *w){
+    (void)w;
+    draw_warning(ui_warning);
+    return true;
+}
+
+// Z-order is the order of display_ui_init()
+static widget_t background_widget = {0, 0, false, background_widget_draw, 0};
+#if !USE_RLE_BACKGROUND
+static widget_t gauge_widget = {0, 0, false, gauge_widget_draw, 0};
+#endif
+static widget_t warning_widget = {0, 0, false, warning_widget_draw, 0};
+static widget_t odometer_widget = {ODOMETER_PERIOD_MS, 0, false, odometer_widget_draw, 0};
+static widget_t speed_widget = {SPEED_PERIOD_MS, 0, false, speed_widget_draw, 0};
+static widget_t direction_widget = {0, 0, false, direction_widget_draw, 0};
+static widget_t needle_widget = {NEEDLE_PERIOD_MS, 0, false, needle_widget_draw, 0};
+
+// Nothing is drawn yet, the first compositor pass clears the screen and draws every widget
+void display_ui_init(void){
+    widget_add(&background_widget);
+#if !USE_RLE_BACKGROUND
+    widget_add(&gauge_widget);  // dial from flash otherwise, already on screen
+#endif
+    widget_add(&warning_widget);
+    widget_add(&odometer_widget);
+    widget_add(&speed_widget);
+    widget_add(&direction_widget);
+    widget_add(&needle_widget);     // on top of everything
+}
+
+// Model updates, event driven widgets are invalidated on change only
+void display_set_speed(uint32_t speed){
+    ui_speed = speed;               // needle picks it up on its next periodic draw
+}
+
+void display_set_distance(uint32_t distance){
+    ui_distance = distance;         // odometer picks it up at 1 Hz
+}
+
+void display_set_direction(bool forwards){
+    if (forwards != ui_forwards) widget_invalidate(&direction_widget);
+    ui_forwards = forwards;
+}
+
+void display_set_warning(bool warning){
+    if (warning != ui_warning) widget_invalidate(&warning_widget);
+    ui_warning = warning;
+}
+
+// One compositor pass, elapsed_ms since the previous pass
+uint32_t display_compose(uint32_t elapsed_ms){
+    uint32_t drawn;
+
+    display_begin();
+    drawn = widgets_compose(elapsed_ms);
+    display_end();
+    return drawn;
+}
+
+// Same pass in slices of budget_cycles (plus one span or glyph at most), for the main loop:
+// begin once per display tick, then step until true. The shadow framebuffer is flushed
+// as part of the pass.
+void display_compose_begin(uint32_t elapsed_ms){
+    widgets_begin(elapsed_ms);
+}
+
+bool display_compose_step(uint32_t budget_cycles){
+    bool done;
+
+    display_begin();
+    widgets_slice(budget_cycles);
+    done = widgets_step();
+#if USE_SHADOW_FB
+    if (done) done = flush_rows();
+#endif
+    widgets_slice(0);
+    display_end();
+    return done;
 }
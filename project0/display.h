@@ -2,17 +2,38 @@
 #define DISPLAY_H_
 
 #include <stdint.h>
+#include <stdbool.h>
 
 // Display functions
 void init_ports_display(void);
-void configure_display_controller_large(void);
+void display_init_start(void);  // non-blocking bring-up: start, then
+bool display_init_poll(void);   // poll from the main loop until true (benches: busy loop)
+void display_begin(void);       // draw calls up to display_end() share cached controller state
+void display_end(void);
 
-void draw_odometer(float distance);
+void draw_odometer(uint32_t distance);    // 1/100 km
+bool draw_speed_readout(uint32_t speed);    // 1/100 km/h, large digits
 void draw_direction(bool directionForwards);
-void draw_arc(void);
-void draw_bresenham(uint32_t speed);
-void draw_bresenham_ticks(void);
-void reset_background(void);
+void draw_arc(void);             // border band and red zone, before draw_bresenham_ticks()
+void draw_bresenham_ticks(void);   // static layer, call once after reset_background()
+void draw_warning(bool warning);
+void reset_background(void);    // with USE_RLE_BACKGROUND: the whole static dial from flash
+void draw_static_layer(void);   // dial drawn at runtime (generator, USE_RLE_BACKGROUND=0)
+uint32_t display_flush(void);   // no-op unless USE_SHADOW_FB
+
+// Widget based UI: set values, then one compositor pass per display tick
+void display_ui_init(void);     // registers the widgets, the first compositor pass clears the screen and draws everything
+void display_set_speed(uint32_t speed);         // 1/100 km/h
+void display_set_distance(uint32_t distance);   // 1/100 km
+void display_set_direction(bool forwards);
+void display_set_warning(bool warning);
+uint32_t display_compose(uint32_t elapsed_ms);
+void display_compose_begin(uint32_t elapsed_ms);    // same pass in slices, see display.c
+bool display_compose_step(uint32_t budget_cycles);  // true once drawn and flushed
+
+// Bus statistics (strobes on Port L), see DISPLAY_BUS_STATS
+uint32_t display_bus_writes(void);
+uint32_t display_needle_bus_writes(void);
 
 extern volatile bool warning_flag;
 
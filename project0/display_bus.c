@@ -0,0 +1,76 @@
+#ifndef HOST_BUILD    // host/ssd1963_model.c provides the bus on Linux
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_types.h"
+#include "inc/tm4c1294ncpdt.h"
+#include <driverlib/sysctl.h>
+#include <driverlib/gpio.h>     // GPIO_PIN_X
+#include <driverlib/timer.h>
+#include <driverlib/interrupt.h>
+#include <inc/hw_memmap.h>      // GPIO_PORTX_BASE
+#include <inc/hw_ints.h>
+
+#include "display_bus.h"
+
+extern uint32_t sysclk;
+
+static volatile bool wait_done = true;
+
+void bus_wait_interrupt_handler(void);
+
+void bus_init(void)
+{
+	// Set Port M Pins 0-7: used as Output of LCD Data
+	SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOM);            // enable clock-gate Port M
+	while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOM));     // wait until clock ready
+	GPIOPinTypeGPIOOutput(GPIO_PORTM_BASE, 0xFF);
+	// Set Port L Pins 0-4: used as Output of LCD Control signals:
+	SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOL);            // Clock Port L
+	while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOL));
+	GPIOPinTypeGPIOOutput(GPIO_PORTL_BASE, BUS_CTRL_PINS);
+}
+
+void bus_reset(bool active)
+{
+    if (active) {
+        GPIO_PORTL_DATA_R = BUS_IDLE;       // Initial state
+        GPIO_PORTL_DATA_R &= ~BUS_RST;      // Hardware reset
+    } else {
+        GPIO_PORTL_DATA_R |= BUS_RST;
+    }
+}
+
+// Controller bring-up waits (reset, PLL lock) on a one-shot timer instead of SysCtlDelay(),
+// the CPU keeps running the main loop meanwhile
+void bus_wait_start(uint32_t us)
+{
+    static bool timer_ready = false;
+
+    if (!timer_ready) {
+        SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER3);
+        while (!SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER3)){};
+        TimerConfigure(TIMER3_BASE, TIMER_CFG_ONE_SHOT);
+        TimerIntRegister(TIMER3_BASE, TIMER_A, bus_wait_interrupt_handler);
+        TimerIntEnable(TIMER3_BASE, TIMER_TIMA_TIMEOUT);
+        IntPrioritySet(INT_TIMER3A, 0x60);  // below the measurement timers
+        IntEnable(INT_TIMER3A);
+        timer_ready = true;
+    }
+    wait_done = false;
+    TimerLoadSet(TIMER3_BASE, TIMER_A, (sysclk / 1000000) * us - 1);
+    TimerEnable(TIMER3_BASE, TIMER_A);
+}
+
+bool bus_wait_done(void)
+{
+    return wait_done;
+}
+
+void bus_wait_interrupt_handler(void)
+{
+    TimerIntClear(TIMER3_BASE, TIMER_TIMA_TIMEOUT);
+    wait_done = true;
+}
+
+#endif
@@ -0,0 +1,162 @@
+#ifndef DISPLAY_BUS_H_
+#define DISPLAY_BUS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Bus HAL of the SSD1963: Port M carries the data byte, Port L the control lines.
+// On the board the strobes hit the GPIO registers, a HOST_BUILD feeds the software
+// model in host/ssd1963_model.c instead.
+
+#define BUS_CTRL_PINS 0x1F      // PL0..PL4 carry the control lines, see USE_QEI in quadrature.h
+
+// Port L control states
+#define BUS_RST 0x10            // Reset line (active low)
+#define BUS_IDLE 0x1F           // Initial state, all lines inactive
+#define BUS_CMD_STROBE 0x11     // Chip select = 0, Command mode select = 0, Write state = 0
+#define BUS_DATA_STROBE 0x15    // Chip select = 0, Write state = 0
+
+// One pixel as the three bytes that go over the bus, precomputed per color
+typedef struct {
+    uint8_t r, g, b;
+    bool gray;                      // r == g == b: Port M stays constant for all three strobes
+} bus_rgb_t;
+
+static inline bus_rgb_t bus_rgb(uint32_t color)
+{
+    bus_rgb_t c;
+    c.r = (color >> 16) & 0xFF;
+    c.g = (color >> 8) & 0xFF;
+    c.b = color & 0xFF;
+    c.gray = (c.r == c.g) && (c.g == c.b);
+    return c;
+}
+
+void bus_init(void);                // Port M / Port L as outputs
+void bus_reset(bool active);        // Drive the hardware reset line
+void bus_wait_start(uint32_t us);   // Non-blocking wait on Timer3 (one-shot)
+bool bus_wait_done(void);           // true once the wait has elapsed
+
+#ifdef HOST_BUILD
+
+#include "ssd1963_model.h"
+
+// Port M latch and the GPIO register stores the board code makes, same sequence as below,
+// so the host bench shows what the gray paths save (the model has no bus timing)
+extern uint8_t bus_port_m;
+extern uint32_t bus_gpio_stores;
+
+#define BUS_PORT_M(v) do { bus_port_m = (v); bus_gpio_stores++; } while (0)
+#define BUS_STROBE() do { ssd1963_write_data(bus_port_m); bus_gpio_stores += 2; } while (0)
+
+static inline void bus_write_command(uint8_t command)
+{
+    BUS_PORT_M(command);
+    ssd1963_write_command(command);
+    bus_gpio_stores += 2;
+}
+
+static inline void bus_write_data(uint8_t data)
+{
+    BUS_PORT_M(data); BUS_STROBE();
+}
+
+static inline void bus_write_rgb(const bus_rgb_t *c)
+{
+    BUS_PORT_M(c->r); BUS_STROBE();
+    BUS_PORT_M(c->g); BUS_STROBE();
+    BUS_PORT_M(c->b); BUS_STROBE();
+}
+
+static inline void bus_fill(const bus_rgb_t *c, uint32_t n)
+{
+    if (c->gray) {
+        BUS_PORT_M(c->r);
+        for (n *= 3; n; n--) BUS_STROBE();
+    } else {
+        while (n--) bus_write_rgb(c);
+    }
+}
+
+static inline void bus_stream(const bus_rgb_t *const *pixels, uint32_t n)
+{
+    while (n--) {
+        const bus_rgb_t *c = *pixels++;
+        if (c->gray) { BUS_PORT_M(c->r); BUS_STROBE(); BUS_STROBE(); BUS_STROBE(); }
+        else bus_write_rgb(c);
+    }
+}
+
+#else
+
+#include "inc/tm4c1294ncpdt.h"
+
+static inline void bus_write_command(uint8_t command)
+{ 	GPIO_PORTM_DATA_R = command;        // Write command byte
+    GPIO_PORTL_DATA_R = BUS_CMD_STROBE;
+    GPIO_PORTL_DATA_R = BUS_IDLE;
+}
+
+static inline void bus_write_data(uint8_t data)
+{ 	GPIO_PORTM_DATA_R = data;           // Write data byte
+    GPIO_PORTL_DATA_R = BUS_DATA_STROBE;
+    GPIO_PORTL_DATA_R = BUS_IDLE;
+}
+
+// Data strobe only, Port M already holds the byte
+#define BUS_STROBE() do { GPIO_PORTL_DATA_R = BUS_DATA_STROBE; GPIO_PORTL_DATA_R = BUS_IDLE; } while (0)
+
+static inline void bus_write_rgb(const bus_rgb_t *c)
+{
+    GPIO_PORTM_DATA_R = c->r; BUS_STROBE();
+    GPIO_PORTM_DATA_R = c->g; BUS_STROBE();
+    GPIO_PORTM_DATA_R = c->b; BUS_STROBE();
+}
+
+// Solid color burst of n pixels into the current window
+static inline void bus_fill(const bus_rgb_t *c, uint32_t n)
+{
+    if (c->gray) {
+        // R == G == B: set Port M once, then only toggle the strobe, 4 pixels per loop
+        uint32_t strobes = n * 3;
+        GPIO_PORTM_DATA_R = c->r;
+        while (strobes >= 12) {
+            BUS_STROBE(); BUS_STROBE(); BUS_STROBE(); BUS_STROBE();
+            BUS_STROBE(); BUS_STROBE(); BUS_STROBE(); BUS_STROBE();
+            BUS_STROBE(); BUS_STROBE(); BUS_STROBE(); BUS_STROBE();
+            strobes -= 12;
+        }
+        while (strobes--) BUS_STROBE();
+    } else {
+        uint8_t r = c->r, g = c->g, b = c->b;
+        while (n >= 4) {
+            GPIO_PORTM_DATA_R = r; BUS_STROBE(); GPIO_PORTM_DATA_R = g; BUS_STROBE(); GPIO_PORTM_DATA_R = b; BUS_STROBE();
+            GPIO_PORTM_DATA_R = r; BUS_STROBE(); GPIO_PORTM_DATA_R = g; BUS_STROBE(); GPIO_PORTM_DATA_R = b; BUS_STROBE();
+            GPIO_PORTM_DATA_R = r; BUS_STROBE(); GPIO_PORTM_DATA_R = g; BUS_STROBE(); GPIO_PORTM_DATA_R = b; BUS_STROBE();
+            GPIO_PORTM_DATA_R = r; BUS_STROBE(); GPIO_PORTM_DATA_R = g; BUS_STROBE(); GPIO_PORTM_DATA_R = b; BUS_STROBE();
+            n -= 4;
+        }
+        while (n--) {
+            GPIO_PORTM_DATA_R = r; BUS_STROBE(); GPIO_PORTM_DATA_R = g; BUS_STROBE(); GPIO_PORTM_DATA_R = b; BUS_STROBE();
+        }
+    }
+}
+
+// Pixel buffer into the current window, one triplet per pixel (glyph cells, shadow
+// framebuffer rows). A gray pixel sets Port M once for its three strobes.
+static inline void bus_stream(const bus_rgb_t *const *pixels, uint32_t n)
+{
+    while (n--) {
+        const bus_rgb_t *c = *pixels++;
+        GPIO_PORTM_DATA_R = c->r; BUS_STROBE();
+        if (c->gray) {
+            BUS_STROBE(); BUS_STROBE();
+        } else {
+            GPIO_PORTM_DATA_R = c->g; BUS_STROBE(); GPIO_PORTM_DATA_R = c->b; BUS_STROBE();
+        }
+    }
+}
+
+#endif
+
+#endif
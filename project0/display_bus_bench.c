@@ -0,0 +1,115 @@
+#ifdef DISPLAY_BENCH    // build with -DDISPLAY_BENCH, main() then runs the benchmark after display init
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "cycles.h"
+#include "display_bus.h"
+
+#ifdef HOST_BUILD
+#include <stdio.h>
+#define BENCH_PRINTF printf
+#else
+#include "utils/uartstdio.h"
+#define BENCH_PRINTF UARTprintf
+#define BENCH_TICKS_PER_US 120      // 120 MHz system clock
+#endif
+
+// Fill throughput of the bus engine against the former per-byte writer,
+// for a full-screen clear and for many small rectangles (glyph cells), and
+// bus_stream() for a glyph cell of mixed pixels. The SSD1963 model has no bus
+// timing, so the host build prints the Port M / Port L stores per variant
+// instead, the strobes are the same for all. Mpx/s only mean something on the board.
+
+static void window(uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1){
+    bus_write_command(0x2A);
+    bus_write_data(x0 >> 8); bus_write_data(x0); bus_write_data(x1 >> 8); bus_write_data(x1);
+    bus_write_command(0x2B);
+    bus_write_data(y0 >> 8); bus_write_data(y0); bus_write_data(y1 >> 8); bus_write_data(y1);
+    bus_write_command(0x2C);
+}
+
+// fill_rect() as it was: three shifted write_data() per pixel
+static void fill_bytewise(uint32_t w, uint32_t h, uint32_t color){
+    uint32_t i;
+    window(0, 0, w - 1, h - 1);
+    for (i = 0; i < w * h; i++) {
+        bus_write_data((color >> 16) & 0xFF);
+        bus_write_data((color >> 8) & 0xFF);
+        bus_write_data(color & 0xFF);
+    }
+}
+
+static void fill_engine(uint32_t w, uint32_t h, uint32_t color){
+    bus_rgb_t c = bus_rgb(color);
+    window(0, 0, w - 1, h - 1);
+    bus_fill(&c, w * h);
+}
+
+// Glyph cell as blit_glyph() draws it: color on black in a checker pattern, per byte
+// as it was and through bus_stream()
+static void glyph_bytewise(uint32_t w, uint32_t h, uint32_t color){
+    uint32_t i;
+    window(0, 0, w - 1, h - 1);
+    for (i = 0; i < w * h; i++) {
+        uint32_t c = (i ^ (i / w)) & 1 ? color : 0;
+        bus_write_data((c >> 16) & 0xFF);
+        bus_write_data((c >> 8) & 0xFF);
+        bus_write_data(c & 0xFF);
+    }
+}
+
+static void glyph_stream(uint32_t w, uint32_t h, uint32_t color){
+    static const bus_rgb_t *cell[8 * 12];
+    bus_rgb_t fg = bus_rgb(color), bg = bus_rgb(0);
+    uint32_t i;
+    for (i = 0; i < w * h; i++) cell[i] = (i ^ (i / w)) & 1 ? &fg : &bg;
+    window(0, 0, w - 1, h - 1);
+    bus_stream(cell, w * h);
+}
+
+// Mpixel/s with two decimals, "rects" rectangles of w x h
+static void run(const char *name, void (*fill)(uint32_t, uint32_t, uint32_t),
+                uint32_t w, uint32_t h, uint32_t rects, uint32_t color){
+    uint32_t i;
+#ifdef HOST_BUILD
+    ssd1963_reset_counters();
+    bus_gpio_stores = 0;
+    for (i = 0; i < rects; i++) fill(w, h, color);
+    BENCH_PRINTF("%-10s %3ux%-3u x%-4u %08x: %9u strobes, %9u GPIO stores\n", name, w, h, rects, color,
+                 ssd1963_commands() + ssd1963_data(), bus_gpio_stores);
+#else
+    uint32_t start = cycles_now();
+    for (i = 0; i < rects; i++) fill(w, h, color);
+    uint32_t ticks = cycles_now() - start;
+    uint32_t mpx_100 = ticks ? (uint32_t)((uint64_t)w * h * rects * BENCH_TICKS_PER_US * 100 / ticks) : 0;
+
+    BENCH_PRINTF("%-10s %3ux%-3u x%-4u %08x: %7u us, %u.%02u Mpx/s\n", name, w, h, rects, color,
+                 ticks / BENCH_TICKS_PER_US, mpx_100 / 100, mpx_100 % 100);
+#endif
+}
+
+void display_bus_bench(void){
+    cycles_init();
+    BENCH_PRINTF("display bus bench\n");
+
+    // full screen clear, gray (R == G == B) and colored
+    run("bytewise", fill_bytewise, 800, 480, 1, 0x000000);
+    run("engine", fill_engine, 800, 480, 1, 0x000000);
+    run("bytewise", fill_bytewise, 800, 480, 1, 0xFF0000);
+    run("engine", fill_engine, 800, 480, 1, 0xFF0000);
+
+    // small rectangles: glyph cell and direction field
+    run("bytewise", fill_bytewise, 8, 12, 1000, 0xFFFFFF);
+    run("engine", fill_engine, 8, 12, 1000, 0xFFFFFF);
+    run("bytewise", fill_bytewise, 20, 20, 1000, 0xFFFF00);
+    run("engine", fill_engine, 20, 20, 1000, 0xFFFF00);
+
+    // mixed glyph cells, white and yellow text
+    run("bytewise", glyph_bytewise, 8, 12, 1000, 0xFFFFFF);
+    run("stream", glyph_stream, 8, 12, 1000, 0xFFFFFF);
+    run("bytewise", glyph_bytewise, 8, 12, 1000, 0xFFFF00);
+    run("stream", glyph_stream, 8, 12, 1000, 0xFFFF00);
+}
+
+#endif
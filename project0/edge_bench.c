@@ -0,0 +1,99 @@
+#ifdef EDGE_BENCH   // build with -DEDGE_BENCH, main() then runs the benchmark once the interrupts are up
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_types.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "utils/uartstdio.h"
+
+#include "cycles.h"
+#include "quadrature.h"
+#include "frame_timing.h"
+#include "interrupt.h"
+
+#if USE_QEI
+#error "edge_bench.c times the Port P edge handlers, build it with USE_QEI 0"
+#endif
+
+// Cycles per S1/S2 edge through the Port P handlers and the highest edge rate the
+// board keeps up with. The edge handlers have the top priority, so Timer0 (window) and
+// Timer1 (display) slip once the edges leave them fewer cycles per second than they need:
+//   f_max = (sysclk - window ISRs/s * window ISR - display ISRs/s * display ISR) / cycles per edge
+// The window and display ISRs run for real too, the speed measurement and the frame
+// statistics are reset afterwards.
+// The handlers are entered for real by pending their NVIC interrupts. The pins do not move
+// meanwhile, so the decoding of a step is timed separately by calling quad_gpio_edge().
+
+#define RUNS 1000
+#define STEPS_PER_S1 4          // quadrature steps per S1 period
+#define RPM_PER_S1_HZ 30        // rpm = S1 periods per second * 30, as calc_speed_dir()
+
+// NVIC interrupt taken before the next cycle stamp
+static inline void barrier(void){
+    __asm(" dsb");
+    __asm(" isb");
+}
+
+// Average cycles of one handler run including exception entry and exit
+static uint32_t isr_cycles(uint32_t interrupt){
+    uint32_t i, start, with, without;
+
+    start = cycles_now();
+    for (i = 0; i < RUNS; i++) { IntPendSet(interrupt); barrier(); }
+    with = cycles_now() - start;
+
+    IntDisable(interrupt);      // same loop, the pended interrupt is not taken
+    start = cycles_now();
+    for (i = 0; i < RUNS; i++) { IntPendSet(interrupt); barrier(); }
+    without = cycles_now() - start;
+    IntPendClear(interrupt);
+    IntEnable(interrupt);
+
+    return (with - without) / RUNS;
+}
+
+// Extra cycles of quad_gpio_edge() for a real step over a repeated state
+static uint32_t step_cycles(void){
+    static const uint8_t forwards[4] = {QUAD_S1, QUAD_S1 | QUAD_S2, QUAD_S2, 0};
+    quad_window_t discard;
+    uint32_t i, start, step, same;
+
+    IntMasterDisable();         // the real edges would mix in
+    quad_gpio_init(0);
+    start = cycles_now();
+    for (i = 0; i < RUNS; i++) quad_gpio_edge(forwards[i & 3], start);
+    step = cycles_now() - start;
+    for (i = 0; i < RUNS; i++) quad_gpio_edge(forwards[(2 - i) & 3], start);  // back to 0, position as before
+    start = cycles_now();
+    for (i = 0; i < RUNS; i++) quad_gpio_edge(0, start);
+    same = cycles_now() - start;
+    quad_gpio_window(&discard, cycles_now(), 0);    // drop the bench steps and their timing
+    quad_gpio_init(GPIOPinRead(GPIO_PORTP_BASE, GPIO_PIN_0 | GPIO_PIN_1));
+    IntMasterEnable();
+
+    return step > same ? (step - same) / RUNS : 0;
+}
+
+void edge_bench(uint32_t sysclk){
+    uint32_t s1 = isr_cycles(INT_GPIOP0);
+    uint32_t s2 = isr_cycles(INT_GPIOP1);
+    uint32_t edge = (s1 > s2 ? s1 : s2) + step_cycles();
+    uint32_t window = isr_cycles(INT_TIMER0A);
+    uint32_t display = isr_cycles(INT_TIMER1A);
+    uint32_t other = (1000 / SUB_WINDOW_MS) * window + (1000 / DISPLAY_WINDOW_MS) * display;   // cycles per second
+    uint32_t f_max = edge ? (sysclk - other) / edge : 0;
+
+    speed_window_reset();       // the pended window ISRs filled the ring with empty sub-windows
+    frame_stats_reset();        // the pended display ticks counted as merged
+    update_display = false;
+    UARTprintf("edge bench, cycles @%u MHz, %d runs\n", sysclk / 1000000, RUNS);
+    UARTprintf("S1 handler %u, S2 handler %u, edge with step %u\n", s1, s2, edge);
+    UARTprintf("window ISR %u, display ISR %u\n", window, display);
+    UARTprintf("max edge rate %u /s = %u S1 Hz = %u rpm before Timer0/Timer1 slip\n",
+               f_max, f_max / STEPS_PER_S1, f_max / STEPS_PER_S1 * RPM_PER_S1_HZ);
+}
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef FIXMATH_H_
+#define FIXMATH_H_
+
+#include <stdint.h>
+
+// Q16.16 fixed point math for the render pipeline and the speed computation.
+// The M4F FPU is single precision only, every double operation is a library call.
+
+typedef int32_t fix16_t;
+
+#define FIX16_ONE 0x00010000
+#define FIX16_MAX 0x7FFFFFFF
+#define FIX16_MIN (-0x7FFFFFFF - 1)
+
+// Compile time conversion of constants, e.g. FIX16_CONST(0.3)
+#define FIX16_CONST(x) ((fix16_t)((x) * 65536.0 + ((x) >= 0 ? 0.5 : -0.5)))
+
+static inline fix16_t fix16_from_int(int32_t a){ return a * FIX16_ONE; }
+static inline int32_t fix16_to_int(fix16_t a){ return a >> 16; }                       // floor
+static inline int32_t fix16_round(fix16_t a){ return (a + (FIX16_ONE >> 1)) >> 16; }   // nearest
+static inline fix16_t fix16_abs(fix16_t a){ return a < 0 ? (a == FIX16_MIN ? FIX16_MAX : -a) : a; }
+
+// Saturating arithmetic
+fix16_t fix16_add(fix16_t a, fix16_t b);
+fix16_t fix16_sub(fix16_t a, fix16_t b);
+fix16_t fix16_mul(fix16_t a, fix16_t b);
+int32_t fix16_mul_int(fix16_t a, int32_t b);    // round(a * b) as integer
+
+// Trigonometry, angle in turns (FIX16_ONE == 360 degrees), table based
+fix16_t fix16_sin_turns(fix16_t turns);
+fix16_t fix16_cos_turns(fix16_t turns);
+
+#endif
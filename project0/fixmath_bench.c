@@ -0,0 +1,135 @@
+#ifdef FIXMATH_BENCH    // build with -DFIXMATH_BENCH, main() then runs the benchmark once at boot
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+#include "cycles.h"
+#include "fixmath.h"
+#include "needle_table.h"
+#include "gauge_layout.h"
+#include "speed.h"
+
+#ifdef HOST_BUILD
+#include <stdio.h>
+#define BENCH_PRINTF printf
+#else
+#include "utils/uartstdio.h"
+#define BENCH_PRINTF UARTprintf
+#endif
+
+// Per frame math of the display loop, double precision (as before) against Q16.16.
+// "Frame" = needle smoothing + needle end point + speed/distance of one speed update,
+// the Q16.16 side through speed.c as calc_speed_dir().
+
+#define FRAMES 1000
+
+volatile int32_t bench_sink;    // keeps the compiler from dropping the loops
+
+static uint32_t frame_double(uint32_t t_speed, uint32_t count){
+    static double c_speed = 0;
+    static float distance = 0;
+    uint32_t start = cycles_now();
+
+    double e_speed = t_speed - c_speed;
+    if (fabs(e_speed) < 1.0) c_speed = t_speed;
+    else c_speed += e_speed * 0.3f;
+
+    double this_speed = c_speed / 100;
+    if (this_speed > MAX_SPEED) this_speed = MAX_SPEED;
+    double angle = (5.0/4.0)*M_PI - ((this_speed/MAX_SPEED) * (3.0/2.0)*M_PI);
+    int x1 = CENTER_POINT_X + (int) NEEDLE_LENGTH * cos(angle);
+    int y1 = CENTER_POINT_Y - (int) NEEDLE_LENGTH * sin(angle);
+
+    float rpm = (count / 0.1f) * (60.0f / 2.0f);
+    float speed_f = rpm * 0.6f * 0.06f;
+    distance += (speed_f / 3600.0f) * 0.1f;
+
+    bench_sink = x1 + y1 + (int)(speed_f * 100) + (int)distance;
+    return cycles_now() - start;
+}
+
+static uint32_t frame_fix16(uint32_t t_speed, uint32_t count){
+    static fix16_t c_speed = 0;
+    static uint32_t distance = 0;
+    static fix16_t distance_rest = 0;
+    fix16_t edges = fix16_from_int(count);
+    uint32_t start = cycles_now();
+
+    fix16_t target = ((int64_t)t_speed << 16) / 100;
+    fix16_t e_speed = fix16_sub(target, c_speed);
+    if (fix16_abs(e_speed) < FIX16_CONST(0.01)) c_speed = target;
+    else c_speed = fix16_add(c_speed, fix16_mul(e_speed, FIX16_CONST(0.3)));
+
+    fix16_t this_speed = c_speed > FIX16_CONST(MAX_SPEED) ? FIX16_CONST(MAX_SPEED) : c_speed;
+    const needle_point_t *p = &needle_table[fix16_mul_int(this_speed, 100 / NEEDLE_TABLE_STEP)];
+    int x1 = CENTER_POINT_X + p->dx;
+    int y1 = CENTER_POINT_Y + p->dy;
+
+    fix16_t speed_f = speed_kmh(edges);
+    distance += speed_distance_mm(speed_f, 1, &distance_rest);
+
+    bench_sink = x1 + y1 + speed_rpm(edges) + fix16_mul_int(speed_f, 100) + distance;
+    return cycles_now() - start;
+}
+
+// Boot time tick placement, 41 ticks with inner/outer end point
+static uint32_t ticks_double(void){
+    uint32_t start = cycles_now();
+    int i, sum = 0;
+    for (i = 0; i <= NUM_TICKS; i++) {
+        double angle = (5.0/4.0)*M_PI + ((double)i / NUM_TICKS) * (-(1.0/4.0)*M_PI - (5.0/4.0)*M_PI);
+        sum += CENTER_POINT_X + (int) OUTER_ARC_RAD * cos(angle);
+        sum += CENTER_POINT_Y - (int) OUTER_ARC_RAD * sin(angle);
+        sum += CENTER_POINT_X + (int) (OUTER_ARC_RAD - 15) * cos(angle);
+        sum += CENTER_POINT_Y - (int) (OUTER_ARC_RAD - 15) * sin(angle);
+    }
+    bench_sink = sum;
+    return cycles_now() - start;
+}
+
+static uint32_t ticks_fix16(void){
+    uint32_t start = cycles_now();
+    int i, sum = 0;
+    for (i = 0; i <= NUM_TICKS; i++) {
+        fix16_t angle = FIX16_CONST(5.0/8.0) - (FIX16_CONST(3.0/4.0) * i) / NUM_TICKS;
+        fix16_t c = fix16_cos_turns(angle);
+        fix16_t s = fix16_sin_turns(angle);
+        sum += CENTER_POINT_X + fix16_to_int(OUTER_ARC_RAD * c);
+        sum += CENTER_POINT_Y + fix16_to_int(-OUTER_ARC_RAD * s);
+        sum += CENTER_POINT_X + fix16_to_int((OUTER_ARC_RAD - 15) * c);
+        sum += CENTER_POINT_Y + fix16_to_int(-(OUTER_ARC_RAD - 15) * s);
+    }
+    bench_sink = sum;
+    return cycles_now() - start;
+}
+
+void fixmath_bench(void){
+    uint32_t i;
+    uint64_t sum_d = 0, sum_f = 0;
+    uint32_t max_d = 0, max_f = 0;
+
+    cycles_init();
+    for (i = 0; i < FRAMES; i++) {
+        // speed profile: ramp up and down over the full scale
+        uint32_t t_speed = (i % 200) < 100 ? (i % 100) * 400 : (100 - i % 100) * 400;
+        uint32_t count = t_speed / 1080;
+        uint32_t d = frame_double(t_speed, count);
+        uint32_t f = frame_fix16(t_speed, count);
+        sum_d += d; sum_f += f;
+        if (d > max_d) max_d = d;
+        if (f > max_f) max_f = f;
+    }
+
+#ifdef HOST_BUILD
+    BENCH_PRINTF("fixmath bench, host ns (not M4F cycles), %d frames\n", FRAMES);
+#else
+    BENCH_PRINTF("fixmath bench, cycles @120 MHz, %d frames\n", FRAMES);
+#endif
+    BENCH_PRINTF("frame  double: avg %u max %u\n", (uint32_t)(sum_d / FRAMES), max_d);
+    BENCH_PRINTF("frame  Q16.16: avg %u max %u\n", (uint32_t)(sum_f / FRAMES), max_f);
+    BENCH_PRINTF("ticks  double: %u\n", ticks_double());
+    BENCH_PRINTF("ticks  Q16.16: %u\n", ticks_fix16());
+}
+
+#endif
@@ -0,0 +1,87 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include "utils/uartstdio.h"
+
+#include "frame_timing.h"
+#include "cycles.h"
+
+#define MAX_SKIP 4  // never drop more than 4 ticks in a row, the needle has to keep moving
+
+/********************************************************************************/
+// Global Variables
+/********************************************************************************/
+static frame_stats_t stats;
+static volatile uint32_t merged = 0;    // written by the display ISR
+static uint32_t budget = 0;             // cycles per display tick
+static uint32_t frame_start = 0;
+static uint32_t skip = 0;               // ticks still to skip
+static volatile uint32_t calc_stamp = 0;    // cycles_now() in the window timer ISR
+
+/********************************************************************************/
+void frame_timing_init(uint32_t budget_cycles){
+    budget = budget_cycles;
+    frame_stats_reset();
+}
+
+bool frame_begin(void){
+    if (skip > 0) {     // previous frame took longer than its slot: merge this tick into the next one
+        skip--;
+        stats.skipped++;
+        return false;
+    }
+    frame_start = cycles_now();
+    return true;
+}
+
+void frame_end(void){
+    uint32_t cycles = cycles_now() - frame_start;   // wraps correctly every ~35 s at 120 MHz
+
+    stats.frames++;
+    stats.total += cycles;
+    if (cycles > stats.worst) stats.worst = cycles;
+
+    if (budget && cycles > budget) {
+        // skip as many ticks as the frame used up beyond its own slot
+        stats.overruns++;
+        skip = cycles / budget;
+        if (skip > MAX_SKIP) skip = MAX_SKIP;
+    }
+}
+
+void frame_tick_merged(void){
+    merged++;
+}
+
+void frame_calc_stamp(void){
+    calc_stamp = cycles_now();
+}
+
+void frame_calc_begin(void){
+    uint32_t delay = cycles_now() - calc_stamp;
+    if (delay > stats.calc_delay) stats.calc_delay = delay;
+}
+
+const frame_stats_t *frame_stats(void){
+    stats.merged = merged;
+    return &stats;
+}
+
+void frame_stats_reset(void){
+    stats.frames = 0;
+    stats.worst = 0;
+    stats.total = 0;
+    stats.overruns = 0;
+    stats.skipped = 0;
+    stats.calc_delay = 0;
+    merged = 0;
+    skip = 0;
+}
+
+void frame_stats_print(void){
+    const frame_stats_t *s = frame_stats();
+    uint32_t avg = s->frames ? (uint32_t)(s->total / s->frames) : 0;
+
+    UARTprintf("Frames: %u, avg %u cyc, worst %u cyc, budget %u cyc\n", s->frames, avg, s->worst, budget);
+    UARTprintf("Overruns: %u, skipped: %u, merged ticks: %u\n", s->overruns, s->skipped, s->merged);
+    UARTprintf("Calc delay after window ISR: worst %u cyc\n", s->calc_delay);
+}
@@ -0,0 +1,33 @@
+#ifndef FRAME_TIMING_H_
+#define FRAME_TIMING_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Frame pacing of the display loop: every frame is timed with the DWT cycle
+// counter against the DISPLAY_WINDOW_MS budget. After an overrun the following
+// display ticks are skipped, so drawing can not pile up in front of calc_speed_dir().
+// The delay from the window timer ISR to calc_speed_dir() is tracked as well.
+
+typedef struct {
+    uint32_t frames;        // frames drawn
+    uint32_t worst;         // longest frame in cycles
+    uint64_t total;         // sum of all frame cycles, for the average
+    uint32_t overruns;      // frames longer than the budget
+    uint32_t skipped;       // display ticks dropped after an overrun
+    uint32_t merged;        // display ticks that fired while the previous one was still pending
+    uint32_t calc_delay;    // worst cycles from the window timer ISR to calc_speed_dir()
+} frame_stats_t;
+
+void frame_timing_init(uint32_t budget_cycles);    // after cycles_init(), which main() runs once at boot
+bool frame_begin(void);         // false: skip this display tick
+void frame_end(void);
+void frame_tick_merged(void);   // from the display timer ISR
+void frame_calc_stamp(void);    // from the window timer ISR, when calc_flag is set
+void frame_calc_begin(void);    // right before calc_speed_dir()
+
+const frame_stats_t *frame_stats(void);
+void frame_stats_reset(void);
+void frame_stats_print(void);   // over UART
+
+#endif
@@ -0,0 +1,109 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "framebuffer.h"
+
+#if USE_SHADOW_FB
+
+/********************************************************************************/
+// Global Variables
+/********************************************************************************/
+// Two pixels per byte, even x in the high nibble: 800*480/2 = 192000 bytes
+static uint8_t fb[FB_HEIGHT][FB_WIDTH / 2];
+// One bit per tile: 50*30 tiles = 1500 bits
+static uint8_t dirty[(FB_TILES_X * FB_TILES_Y + 7) / 8];
+static uint32_t dirty_count = 0;
+
+static inline void mark_dirty(uint32_t x, uint32_t y){
+    uint32_t tile = (y / FB_TILE_SIZE) * FB_TILES_X + (x / FB_TILE_SIZE);
+    uint8_t bit = 1 << (tile & 7);
+
+    if (!(dirty[tile >> 3] & bit)) {
+        dirty[tile >> 3] |= bit;
+        dirty_count++;
+    }
+}
+
+/********************************************************************************/
+// Pixel access
+/********************************************************************************/
+void fb_set_pixel(uint32_t x, uint32_t y, uint8_t index){
+    if (x >= FB_WIDTH || y >= FB_HEIGHT) return;    // clip
+
+    uint8_t *p = &fb[y][x >> 1];
+    uint8_t old = *p;
+    uint8_t val = (x & 1) ? ((old & 0xF0) | (index & 0x0F))
+                          : ((old & 0x0F) | (index << 4));
+    if (val != old) {   // only real changes make a tile dirty
+        *p = val;
+        mark_dirty(x, y);
+    }
+}
+
+uint8_t fb_get_pixel(uint32_t x, uint32_t y){
+    if (x >= FB_WIDTH || y >= FB_HEIGHT) return 0;
+    uint8_t b = fb[y][x >> 1];
+    return (x & 1) ? (b & 0x0F) : (b >> 4);
+}
+
+const uint8_t *fb_row(uint32_t y){
+    return fb[y];
+}
+
+void fb_hspan(uint32_t x0, uint32_t x1, uint32_t y, uint8_t index){
+    if (x0 > x1) { uint32_t t = x0; x0 = x1; x1 = t; }
+    if (y >= FB_HEIGHT || x0 >= FB_WIDTH) return;
+    if (x1 >= FB_WIDTH) x1 = FB_WIDTH - 1;
+
+    uint8_t pair = (index << 4) | (index & 0x0F);
+    uint32_t x = x0;
+
+    // odd start pixel
+    if (x & 1) { fb_set_pixel(x, y, index); x++; }
+
+    // whole bytes, two pixels at once
+    while (x + 1 <= x1) {
+        uint8_t *p = &fb[y][x >> 1];
+        if (*p != pair) {
+            *p = pair;
+            mark_dirty(x, y);   // both pixels lie in the same tile (tile size is even)
+        }
+        x += 2;
+    }
+
+    // even end pixel
+    if (x == x1) fb_set_pixel(x, y, index);
+}
+
+void fb_fill_rect(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint8_t index){
+    uint32_t row;
+    if (width == 0 || height == 0) return;
+    for (row = y; row < y + height; row++) {
+        fb_hspan(x, x + width - 1, row, index);
+    }
+}
+
+/********************************************************************************/
+// Dirty tiles
+/********************************************************************************/
+void fb_invalidate_all(void){
+    memset(dirty, 0xFF, sizeof(dirty));
+    dirty_count = FB_TILES_X * FB_TILES_Y;
+}
+
+bool fb_tile_dirty(uint32_t tx, uint32_t ty){
+    uint32_t tile = ty * FB_TILES_X + tx;
+    return (dirty[tile >> 3] >> (tile & 7)) & 1;
+}
+
+void fb_clear_dirty(void){
+    memset(dirty, 0, sizeof(dirty));
+    dirty_count = 0;
+}
+
+uint32_t fb_dirty_count(void){
+    return dirty_count;
+}
+
+#endif
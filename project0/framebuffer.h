@@ -0,0 +1,32 @@
+#ifndef FRAMEBUFFER_H_
+#define FRAMEBUFFER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Shadow framebuffer in SRAM, 4 bit palette index per pixel (index into colorarray)
+// Set to 1 to let display.c draw into SRAM and flush only changed tiles
+#ifndef USE_SHADOW_FB
+#define USE_SHADOW_FB 0
+#endif
+
+#define FB_WIDTH 800
+#define FB_HEIGHT 480
+#define FB_TILE_SIZE 16                         // Tiles of 16x16 pixels
+#define FB_TILES_X (FB_WIDTH / FB_TILE_SIZE)    // 50 tiles per row
+#define FB_TILES_Y (FB_HEIGHT / FB_TILE_SIZE)   // 30 tile rows
+
+// Drawing into the shadow buffer, tiles are only marked dirty if a pixel really changes
+void fb_set_pixel(uint32_t x, uint32_t y, uint8_t index);
+void fb_hspan(uint32_t x0, uint32_t x1, uint32_t y, uint8_t index);
+void fb_fill_rect(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint8_t index);
+uint8_t fb_get_pixel(uint32_t x, uint32_t y);
+const uint8_t *fb_row(uint32_t y);     // packed row for flushing, 2 pixels per byte
+
+// Dirty tile bookkeeping
+void fb_invalidate_all(void);
+bool fb_tile_dirty(uint32_t tx, uint32_t ty);
+void fb_clear_dirty(void);
+uint32_t fb_dirty_count(void);
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef GAUGE_LAYOUT_H_
+#define GAUGE_LAYOUT_H_
+
+// Layout of the speed gauges. Tick and label positions and the needle table are
+// computed from these values by host/gen_gauge.c into gauge_tables.c and
+// needle_table.c (make -C project0/host tables). Regenerate after changes.
+
+// Gauge styles, either one or both at once
+#ifndef GAUGE_STYLE_ARC
+#define GAUGE_STYLE_ARC 1
+#endif
+#ifndef GAUGE_STYLE_LINEAR
+#define GAUGE_STYLE_LINEAR 0
+#endif
+
+#define MAX_SPEED 400.0f
+#define SPEED_STEP 10       // Speedometer pos. where ticks are marked
+#define XTSPD 382   // Starting X-coord for KM/H (both styles)
+#define YTSPD 145   // Starting Y-coord for KM/H
+
+/********************************************************************************/
+// Arc gauge: 270 deg around the center, 0 km/h bottom left
+/********************************************************************************/
+#define CENTER_POINT_X 400
+#define CENTER_POINT_Y 280
+#define ARC_START_TURNS (5.0/8.0)   // 225 deg at 0 km/h
+#define ARC_SWEEP_TURNS (3.0/4.0)   // clockwise down to -45 deg at MAX_SPEED
+#define OUTER_ARC_RAD 270   // Radius for ticks arc, border band starts here
+#define INNER_ARC_RAD 255   // Inner end of the long ticks, red zone starts here
+#define NEEDLE_LENGTH 245   
+#define NEEDLE_HALF_WIDTH 4 // Half width of the needle base at the center, tapers to the tip
+#define NUM_TICKS 40        // Tick every 10 km/h
+#define LONG_TICK_EVERY 5   // Every 5th tick is long and labelled
+#define SHORT_TICK 5        // Length of short tick
+#define LONG_TICK 15        // Length of long tick
+#define LABEL_INSET 25      // Labels this far inside the long ticks
+#define BORDER_WIDTH 4      // Thick border band outside the ticks arc
+#define RED_ZONE_SPEED 350  // Red band from here up to MAX_SPEED
+#define RED_ZONE_WIDTH 7    // Red band from INNER_ARC_RAD outwards, the ticks are drawn over it
+
+/********************************************************************************/
+// Linear gauge: horizontal scale, vertical needle above it (top left, clear of the arc)
+/********************************************************************************/
+#define LIN_X 12            // x of 0 km/h
+#define LIN_WIDTH 200       // pixels from 0 to MAX_SPEED
+#define LIN_Y 40            // top of the ticks, the needle ends one row above
+#define LIN_NUM_TICKS 20    // Tick every 20 km/h
+#define LIN_LONG_TICK_EVERY 5
+#define LIN_SHORT_TICK 5
+#define LIN_LONG_TICK 10
+#define LIN_LABEL_GAP 3     // Labels this far below the long ticks
+#define LIN_NEEDLE_HEIGHT 28
+#define LIN_NEEDLE_WIDTH 2
+
+#endif
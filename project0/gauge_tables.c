@@ -0,0 +1,36 @@
+// Generated by host/gen_gauge.c (make -C project0/host tables) from gauge_layout.h, do not edit
+#include "gauge_tables.h"
+
+const gauge_tick_t arc_ticks[41] = {
+    {209, 470, 219, 460}, {187, 447, 191, 444}, {169, 421, 174, 418}, {154, 393, 159, 390},
+    {143, 363, 147, 361}, {135, 332, 149, 329}, {130, 301, 135, 300}, {130, 269, 135, 269},
+    {133, 237, 138, 238}, {140, 206, 144, 208}, {150, 176, 164, 182}, {164, 148, 168, 150},
+    {181, 121, 185, 124}, {201, 96, 205, 100}, {224, 74, 227, 78}, {249, 55, 258, 67},
+    {277, 39, 279, 43}, {306, 26, 308, 31}, {336, 17, 338, 22}, {368, 11, 368, 16},
+    {400, 10, 400, 25}, {431, 11, 431, 16}, {463, 17, 461, 22}, {493, 26, 491, 31},
+    {522, 39, 520, 43}, {550, 55, 541, 67}, {575, 74, 572, 78}, {598, 96, 594, 100},
+    {618, 121, 614, 124}, {635, 148, 631, 150}, {649, 176, 635, 182}, {659, 206, 655, 208},
+    {666, 237, 661, 238}, {669, 269, 664, 269}, {669, 301, 664, 300}, {664, 332, 650, 329},
+    {656, 363, 652, 361}, {645, 393, 640, 390}, {630, 421, 625, 418}, {612, 447, 608, 444},
+    {590, 470, 580, 460},
+};
+
+const gauge_label_t arc_labels[9] = {
+    {239, 436, 0}, {176, 318, 50}, {189, 185, 100}, {264, 91, 150},
+    {392, 53, 200}, {519, 91, 250}, {588, 185, 300}, {601, 318, 350},
+    {538, 436, 400},
+};
+
+const gauge_tick_t lin_ticks[21] = {
+    {12, 40, 12, 49}, {22, 40, 22, 44}, {32, 40, 32, 44}, {42, 40, 42, 44},
+    {52, 40, 52, 44}, {62, 40, 62, 49}, {72, 40, 72, 44}, {82, 40, 82, 44},
+    {92, 40, 92, 44}, {102, 40, 102, 44}, {112, 40, 112, 49}, {122, 40, 122, 44},
+    {132, 40, 132, 44}, {142, 40, 142, 44}, {152, 40, 152, 44}, {162, 40, 162, 49},
+    {172, 40, 172, 44}, {182, 40, 182, 44}, {192, 40, 192, 44}, {202, 40, 202, 44},
+    {212, 40, 212, 49},
+};
+
+const gauge_label_t lin_labels[5] = {
+    {8, 53, 0}, {49, 53, 100}, {99, 53, 200}, {149, 53, 300},
+    {199, 53, 400},
+};
@@ -0,0 +1,27 @@
+// Generated by host/gen_gauge.c (make -C project0/host tables) from gauge_layout.h, do not edit
+#ifndef GAUGE_TABLES_H_
+#define GAUGE_TABLES_H_
+
+#include <stdint.h>
+
+typedef struct {
+    int16_t x0, y0;     // outer end (arc), top (linear)
+    int16_t x1, y1;
+} gauge_tick_t;
+
+typedef struct {
+    int16_t x, y;       // text anchor top left
+    int16_t value;      // speed in km/h
+} gauge_label_t;
+
+#define ARC_NUM_TICKS 41
+#define ARC_NUM_LABELS 9
+#define LIN_NUM_TICKS_TOTAL 21
+#define LIN_NUM_LABELS 5
+
+extern const gauge_tick_t arc_ticks[ARC_NUM_TICKS];
+extern const gauge_label_t arc_labels[ARC_NUM_LABELS];
+extern const gauge_tick_t lin_ticks[LIN_NUM_TICKS_TOTAL];
+extern const gauge_label_t lin_labels[LIN_NUM_LABELS];
+
+#endif
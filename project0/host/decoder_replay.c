@@ -0,0 +1,170 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "quadrature.h"
+#include "qei_model.h"
+#include "interrupt.h"      // SUB_WINDOW_MS, SUB_WINDOWS
+
+// Replays an S1/S2 edge trace through both decoder backends of quadrature.c, the GPIO
+// path (one call per edge, like the Port P ISR) and the QEI path (register model),
+// and prints steps, direction and speed per 100 ms window side by side. Like the timer ISR
+// both are taken every 10 ms sub-window and summed over the last 100 ms.
+//
+// Trace format, one edge per line: <time in us> <S1 level> <S2 level>, '#' comments.
+// Without a trace file a built-in drive profile is used, -w <file> writes it out. It drops
+// one edge at 2 s, which both decoders have to report as an illegal transition.
+
+#define CYCLES_PER_US 120u                      // 120 MHz, as the DWT counter on the board
+#define SUB_WINDOW_US (SUB_WINDOW_MS * 1000u)
+#define WINDOW_CYCLES (WINDOW_MS * 1000u * CYCLES_PER_US)   // 100 ms, window_timer_period
+#define TIMEOUT_CYCLES (500000u * CYCLES_PER_US)    // ZERO_SPEED_TIMEOUT_MS
+#define KMH_PER_EDGE 10.8                       // SPEED_PER_EDGE of interrupt.c, CIRCUMFERENCE 0.6
+#define MISSED_EDGE_US 2000000                  // built-in profile: edge lost on the way
+
+typedef struct {
+    uint32_t t_us;
+    bool s1, s2;
+} edge_t;
+
+static edge_t *edges = 0;
+static size_t num_edges = 0, cap_edges = 0;
+
+static void add_edge(uint32_t t_us, bool s1, bool s2){
+    if (num_edges == cap_edges) {
+        cap_edges = cap_edges ? 2 * cap_edges : 4096;
+        edges = realloc(edges, cap_edges * sizeof(edge_t));
+        if (!edges) { perror("realloc"); exit(1); }
+    }
+    edges[num_edges].t_us = t_us;
+    edges[num_edges].s1 = s1;
+    edges[num_edges].s2 = s2;
+    num_edges++;
+}
+
+static bool load_trace(const char *path){
+    FILE *f = fopen(path, "r");
+    char line[128];
+    unsigned t, s1, s2;
+
+    if (!f) return false;
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] == '#') continue;
+        if (sscanf(line, "%u %u %u", &t, &s1, &s2) == 3) add_edge(t, s1, s2);
+    }
+    fclose(f);
+    return true;
+}
+
+// Speed in km/h over time in us: up to 300 km/h, down to a crawl, stop, reverse
+static double profile_kmh(double t){
+    if (t < 3e6) return t * 1e-4;                   // 0 -> 300 km/h in 3 s
+    if (t < 4e6) return 300.0;
+    if (t < 6e6) return 300.0 - (t - 4e6) * 1.475e-4;   // down to 5 km/h
+    if (t < 7e6) return 5.0;
+    if (t < 8e6) return 0.0;
+    if (t < 9e6) return -20.0;                      // reverse
+    return 0.0;
+}
+
+// Quadrature from the profile: four S1/S2 states per S1 period, S1 leads S2 forwards
+static void synth_trace(void){
+    static const bool s1_seq[4] = {true, true, false, false};
+    static const bool s2_seq[4] = {false, true, true, false};
+    double phase = 0.0;
+    int state = 3;      // 00
+    bool missed = false;
+    uint32_t t;
+
+    for (t = 0; t < 10000000; t++) {
+        double v = profile_kmh(t);
+        phase += v / KMH_PER_EDGE * 10.0 * 4.0 * 1e-6;  // quarter periods per us
+        if (phase >= 1.0 || phase <= -1.0) {
+            state = (state + (phase > 0 ? 1 : 3)) & 3;
+            phase += phase > 0 ? -1.0 : 1.0;
+            if (t >= MISSED_EDGE_US && !missed) missed = true;      // never seen by the decoders
+            else add_edge(t, s1_seq[state], s2_seq[state]);
+        }
+    }
+}
+
+static bool write_trace(const char *path){
+    FILE *f = fopen(path, "w");
+    size_t i;
+
+    if (!f) return false;
+    fprintf(f, "# t_us S1 S2\n");
+    for (i = 0; i < num_edges; i++) fprintf(f, "%u %d %d\n", edges[i].t_us, edges[i].s1, edges[i].s2);
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char **argv){
+    const char *trace = 0, *out = 0;
+    static quad_window_t g_subs[SUB_WINDOWS], q_subs[SUB_WINDOWS];   // rings as in interrupt.c
+    quad_window_t gw = {0}, qw = {0}, g_sub, q_sub;
+    uint32_t t_end, t_win, sub_next = 0;
+    size_t next = 0;
+    uint32_t gpio_total = 0, qei_total = 0, max_diff = 0, dir_diff = 0, windows = 0;
+    uint32_t gpio_illegal = 0, qei_illegal = 0;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-w") && i + 1 < argc) out = argv[++i];
+        else trace = argv[i];
+    }
+    if (trace) {
+        if (!load_trace(trace)) { fprintf(stderr, "could not read %s\n", trace); return 1; }
+    } else {
+        synth_trace();
+    }
+    if (out && !write_trace(out)) { fprintf(stderr, "could not write %s\n", out); return 1; }
+    if (num_edges == 0) { fprintf(stderr, "empty trace\n"); return 1; }
+
+    quad_qei_init();
+    t_end = edges[num_edges - 1].t_us + 1000000;    // one more second to see the stop
+
+    printf("%8s | %5s %3s %9s | %5s %3s %9s\n", "t ms", "GPIO", "dir", "km/h", "QEI", "dir", "km/h");
+    for (t_win = SUB_WINDOW_US; t_win <= t_end; t_win += SUB_WINDOW_US) {
+        double g_kmh, q_kmh;
+        uint32_t diff;
+
+        for (; next < num_edges && edges[next].t_us < t_win; next++) {
+            quad_gpio_edge((edges[next].s1 ? QUAD_S1 : 0) | (edges[next].s2 ? QUAD_S2 : 0),
+                           edges[next].t_us * CYCLES_PER_US);
+            qei_model_input(edges[next].s1, edges[next].s2);
+        }
+        quad_gpio_window(&g_sub, t_win * CYCLES_PER_US, TIMEOUT_CYCLES);
+        quad_qei_window(&q_sub);
+        quad_window_slide(&gw, &g_sub, &g_subs[sub_next]);
+        quad_window_slide(&qw, &q_sub, &q_subs[sub_next]);
+        g_subs[sub_next] = g_sub;
+        q_subs[sub_next] = q_sub;
+        sub_next = (sub_next + 1) % SUB_WINDOWS;
+        gpio_illegal += g_sub.illegal;
+        qei_illegal += q_sub.illegal;
+
+        // speed every sub-window as calc_speed_dir(), the table shows every full window
+        g_kmh = quad_edges(&gw, WINDOW_CYCLES, TIMEOUT_CYCLES) / 65536.0 * KMH_PER_EDGE;
+        q_kmh = quad_edges(&qw, WINDOW_CYCLES, TIMEOUT_CYCLES) / 65536.0 * KMH_PER_EDGE;
+        if (t_win % (WINDOW_MS * 1000u)) continue;
+        printf("%8u | %5u %3s %9.2f | %5u %3s %9.2f\n", t_win / 1000,
+               gw.steps, gw.forwards ? "V" : "R", g_kmh, qw.steps, qw.forwards ? "V" : "R", q_kmh);
+
+        gpio_total += gw.steps;
+        qei_total += qw.steps;
+        diff = gw.steps > qw.steps ? gw.steps - qw.steps : qw.steps - gw.steps;
+        if (diff > max_diff) max_diff = diff;
+        if (gw.steps && qw.steps && gw.forwards != qw.forwards) dir_diff++;
+        windows++;
+    }
+
+    printf("%u edges, %u windows: steps GPIO %u, QEI %u, max difference per window %u, "
+           "direction mismatches %u\n", (unsigned)num_edges, windows, gpio_total, qei_total, max_diff, dir_diff);
+    printf("position GPIO %d, QEI %d, illegal transitions GPIO %u, QEI %u (windows flagged)\n",
+           gw.position, qw.position, gpio_illegal, qei_illegal);
+    printf("edge interrupts: GPIO %u, QEI 0\n", (unsigned)num_edges);
+    return 0;
+}
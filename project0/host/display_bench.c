@@ -0,0 +1,99 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "display.h"
+#include "ssd1963_model.h"
+
+// Host benchmark of the display layer against the SSD1963 model:
+// bus strobes per call and a PNG of the resulting screen.
+
+volatile bool warning_flag = false;     // owned by interrupt.c on the board
+
+static void report(const char *name){
+    printf("%-28s %9u cmd %10u data %10u strobes %9u px\n",
+           name, ssd1963_commands(), ssd1963_data(),
+           ssd1963_commands() + ssd1963_data(), ssd1963_pixels());
+    ssd1963_reset_counters();
+}
+
+int main(int argc, char **argv){
+    const char *png = argc > 1 ? argv[1] : "display_bench.png";
+    int i;
+
+    init_ports_display();
+    display_init_start();
+    while (!display_init_poll());
+    report("configure_display");
+
+    display_ui_init();
+    display_compose(0);
+    display_flush();
+    report("first compose (dial and all widgets)");
+
+    // needle settling from 0 to 250 km/h at 50 Hz, then one steady state frame
+    display_set_speed(25000);
+    for (i = 0; i < 20; i++) {
+        display_compose(20);
+        display_flush();
+    }
+    report("20 frames 0->250 km/h");
+
+    display_compose(20);
+    display_flush();
+    report("steady frame");
+
+    display_set_speed(25100);
+    display_compose(20);
+    report("needle 250->251");
+    printf("%-28s %9u strobes\n", "  needle path", display_needle_bus_writes());
+
+    // same kind of frame drawn in 20 us slices, as the main loop does between calc_flag checks
+    display_set_speed(9000);
+    display_compose_begin(20);
+    for (i = 1; !display_compose_step(20000); i++);
+    display_set_speed(25100);
+    display_compose_begin(20);
+    for (i++; !display_compose_step(20000); i++);
+    report("2 frames in 20 us slices");
+    printf("%-28s %9d slices\n", "  compose steps", i);
+
+    draw_speed_readout(8800);
+    display_flush();
+    report("speed readout 3 digits");
+
+    draw_speed_readout(8900);
+    display_flush();
+    report("speed readout 1 digit");
+
+    display_set_distance(12345);
+    display_compose(20);
+    display_flush();
+    report("distance set, odometer idle");
+
+    display_compose(1000);
+    display_flush();
+    report("odometer 1 Hz tick");
+
+    display_set_distance(12346);
+    display_compose(1000);
+    display_flush();
+    report("odometer +10 m");
+
+    display_set_direction(false);
+    display_compose(20);
+    display_flush();
+    report("direction change");
+
+    display_set_warning(true);
+    display_compose(20);
+    display_flush();
+    report("warning on");
+
+    if (!ssd1963_dump_png(png)) {
+        fprintf(stderr, "could not write %s\n", png);
+        return 1;
+    }
+    printf("screen written to %s\n", png);
+    return 0;
+}
@@ -0,0 +1,6 @@
+void display_bus_bench(void);
+
+int main(void){
+    display_bus_bench();
+    return 0;
+}
@@ -0,0 +1,6 @@
+void fixmath_bench(void);
+
+int main(void){
+    fixmath_bench();
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "display.h"
+#include "gauge_layout.h"
+#include "ssd1963_model.h"
+
+// Renders the static dial (bands, ticks, labels, KM/H) with display.c against the
+// SSD1963 model and writes it as run-length encoded palette image to dial_rle.c/.h.
+// Built with USE_RLE_BACKGROUND=0, see the Makefile target "dial".
+//
+// One run is a uint16_t: length (1..800) << 3 | palette index (colorarray in display.c).
+// dial_rle_row[y] is the first run of row y, runs never cross a row.
+
+#define WIDTH 800
+#define HEIGHT 480
+#define MAX_RUNS 65535
+#define PALETTE_SIZE 7      // entries of colorarray, index fits 3 bits
+
+volatile bool warning_flag = false;     // owned by interrupt.c on the board
+extern int colorarray[];
+
+static uint16_t runs[MAX_RUNS];
+static uint16_t row_start[HEIGHT + 1];
+
+static int palette_index(uint32_t rgb){
+    unsigned int i;
+    for (i = 0; i < PALETTE_SIZE; i++)
+        if ((uint32_t)colorarray[i] == rgb) return i;
+    return -1;
+}
+
+int main(int argc, char **argv){
+    const char *c_path = argc > 2 ? argv[1] : "../dial_rle.c";
+    const char *h_path = argc > 2 ? argv[2] : "../dial_rle.h";
+    uint32_t num_runs = 0;
+    int x, y;
+    FILE *f;
+
+    init_ports_display();
+    display_init_start();
+    while (!display_init_poll());
+    reset_background();
+    draw_static_layer();
+
+    for (y = 0; y < HEIGHT; y++) {
+        row_start[y] = num_runs;
+        for (x = 0; x < WIDTH; ) {
+            uint32_t rgb = ssd1963_pixel(x, y);
+            int index = palette_index(rgb);
+            int len = 1;
+            if (index < 0) {
+                fprintf(stderr, "pixel %d,%d: color %06x not in the palette\n", x, y, rgb);
+                return 1;
+            }
+            while (x + len < WIDTH && ssd1963_pixel(x + len, y) == rgb) len++;
+            if (num_runs >= MAX_RUNS) {
+                fprintf(stderr, "more than %d runs\n", MAX_RUNS);
+                return 1;
+            }
+            runs[num_runs++] = (len << 3) | index;
+            x += len;
+        }
+    }
+    row_start[HEIGHT] = num_runs;
+
+    f = fopen(h_path, "w");
+    if (!f) { perror(h_path); return 1; }
+    fprintf(f, "// Generated by host/gen_dial.c (make -C project0/host dial), do not edit\n");
+    fprintf(f, "#ifndef DIAL_RLE_H_\n#define DIAL_RLE_H_\n\n#include <stdint.h>\n\n");
+    fprintf(f, "#define DIAL_RLE_STYLE_ARC %d       // gauge styles of the image\n", GAUGE_STYLE_ARC);
+    fprintf(f, "#define DIAL_RLE_STYLE_LINEAR %d\n", GAUGE_STYLE_LINEAR);
+    fprintf(f, "#define DIAL_RLE_RUNS %u          // %u bytes runs + %u bytes row table in flash\n",
+            num_runs, num_runs * 2, (HEIGHT + 1) * 2);
+    fprintf(f, "#define DIAL_RLE_LEN(run) ((run) >> 3)\n");
+    fprintf(f, "#define DIAL_RLE_INDEX(run) ((run) & 7)  // colorarray index\n\n");
+    fprintf(f, "extern const uint16_t dial_rle[DIAL_RLE_RUNS];\n");
+    fprintf(f, "extern const uint16_t dial_rle_row[%d];     // first run of each row, [%d]: end\n\n", HEIGHT + 1, HEIGHT);
+    fprintf(f, "#endif\n");
+    fclose(f);
+
+    f = fopen(c_path, "w");
+    if (!f) { perror(c_path); return 1; }
+    fprintf(f, "// Generated by host/gen_dial.c (make -C project0/host dial), do not edit\n");
+    fprintf(f, "#include \"dial_rle.h\"\n\n");
+    fprintf(f, "const uint16_t dial_rle[DIAL_RLE_RUNS] = {");
+    for (x = 0; x < (int)num_runs; x++)
+        fprintf(f, "%s0x%04X,", x % 12 ? " " : "\n    ", runs[x]);
+    fprintf(f, "\n};\n\nconst uint16_t dial_rle_row[%d] = {", HEIGHT + 1);
+    for (y = 0; y <= HEIGHT; y++)
+        fprintf(f, "%s%u,", y % 12 ? " " : "\n    ", row_start[y]);
+    fprintf(f, "\n};\n");
+    fclose(f);
+
+    printf("dial: %u runs, %u bytes flash (runs %u + row table %u), raw 4 bpp would be %u\n",
+           num_runs, num_runs * 2 + (HEIGHT + 1) * 2, num_runs * 2, (HEIGHT + 1) * 2, WIDTH * HEIGHT / 2);
+    return 0;
+}
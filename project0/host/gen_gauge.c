@@ -0,0 +1,190 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "gauge_layout.h"
+#include "fixmath.h"
+
+// Resolves gauge_layout.h into constant tick and label tables (gauge_tables.c/.h):
+// arc geometry with the same Q16.16 sin/cos the board used to run at boot, so the
+// dial stays pixel-identical, linear geometry by plain integer math.
+// Both styles are always emitted, display.c only references the selected ones.
+// The needle end points (needle_table.c/.h) come from the same arc angles, so the
+// needle meets the ticks and the bands at every speed.
+
+#define CHAR_WIDTH 8        // glyph cell of display.c
+#define CHAR_HEIGHT 12
+#define NEEDLE_STEP 25      // needle table step in 1/100 km/h (0.25 km/h, < 1 px at the needle tip)
+#define NEEDLE_SIZE ((int)MAX_SPEED * 100 / NEEDLE_STEP + 1)
+
+typedef struct { int x0, y0, x1, y1; } tick_t;
+typedef struct { int x, y, value; } label_t;
+
+static tick_t arc_ticks[NUM_TICKS + 1];
+static label_t arc_labels[NUM_TICKS + 1];
+static int arc_num_labels = 0;
+static int needle_dx[NEEDLE_SIZE], needle_dy[NEEDLE_SIZE];
+static tick_t lin_ticks[LIN_NUM_TICKS + 1];
+static label_t lin_labels[LIN_NUM_TICKS + 1];
+static int lin_num_labels = 0;
+
+static void arc_layout(int x0, int y0){
+    const fix16_t start_angle = FIX16_CONST(ARC_START_TURNS);
+    const fix16_t sweep = FIX16_CONST(ARC_SWEEP_TURNS);
+    int i;
+
+    for (i = 0; i <= NUM_TICKS; i++) {
+        fix16_t angle = start_angle - (sweep * i) / NUM_TICKS;
+        fix16_t c = fix16_cos_turns(angle);
+        fix16_t s = fix16_sin_turns(angle);
+        int len = i % LONG_TICK_EVERY == 0 ? LONG_TICK : SHORT_TICK;
+
+        // outer end on the tick arc, inner end towards the center
+        arc_ticks[i].x0 = x0 + fix16_to_int(OUTER_ARC_RAD * c);
+        arc_ticks[i].y0 = y0 + fix16_to_int(-OUTER_ARC_RAD * s);
+        arc_ticks[i].x1 = x0 + fix16_to_int((OUTER_ARC_RAD - len) * c);
+        arc_ticks[i].y1 = y0 + fix16_to_int(-(OUTER_ARC_RAD - len) * s);
+        if (len != LONG_TICK) continue;
+
+        // speed number, anchored depending on the side of the arc
+        const int r_text = OUTER_ARC_RAD - LONG_TICK - LABEL_INSET;
+        fix16_t px = fix16_from_int(x0) + r_text * c;
+        fix16_t py = fix16_from_int(y0) - r_text * s;
+        fix16_t tx, ty;
+        if (angle < FIX16_CONST(1.0/12.0)) {            // RIGHT side
+            tx = px - fix16_from_int(3 * CHAR_WIDTH);
+            ty = py - fix16_from_int(CHAR_HEIGHT/2);
+        } else if (angle <= FIX16_CONST(5.0/12.0)) {    // TOP arc
+            tx = px - fix16_from_int(CHAR_WIDTH);
+            ty = py + fix16_from_int(CHAR_HEIGHT/4);
+        } else {                                        // LEFT side
+            tx = px + fix16_from_int(CHAR_WIDTH/4);
+            ty = py - fix16_from_int(CHAR_HEIGHT/2);
+        }
+        arc_labels[arc_num_labels].x = fix16_to_int(tx);
+        arc_labels[arc_num_labels].y = fix16_to_int(ty);
+        arc_labels[arc_num_labels].value = i * SPEED_STEP;
+        arc_num_labels++;
+    }
+}
+
+// Needle end point relative to the center for every NEEDLE_STEP, angle as SPEED_TURNS() in display.c
+static void needle_layout(void){
+    const fix16_t start_angle = FIX16_CONST(ARC_START_TURNS);
+    const fix16_t sweep = FIX16_CONST(ARC_SWEEP_TURNS);
+    int i;
+
+    for (i = 0; i < NEEDLE_SIZE; i++) {
+        fix16_t angle = start_angle - (fix16_t)((int64_t)sweep * i * NEEDLE_STEP / ((int)MAX_SPEED * 100));
+        needle_dx[i] = fix16_to_int(NEEDLE_LENGTH * fix16_cos_turns(angle));
+        needle_dy[i] = fix16_to_int(-NEEDLE_LENGTH * fix16_sin_turns(angle));
+    }
+}
+
+static void lin_layout(void){
+    int i;
+    for (i = 0; i <= LIN_NUM_TICKS; i++) {
+        int x = LIN_X + (i * LIN_WIDTH + LIN_NUM_TICKS / 2) / LIN_NUM_TICKS;
+        int len = i % LIN_LONG_TICK_EVERY == 0 ? LIN_LONG_TICK : LIN_SHORT_TICK;
+        lin_ticks[i].x0 = lin_ticks[i].x1 = x;
+        lin_ticks[i].y0 = LIN_Y;
+        lin_ticks[i].y1 = LIN_Y + len - 1;
+        if (len != LIN_LONG_TICK) continue;
+
+        // centered under the tick, 9 px per digit
+        int value = (int)(i * MAX_SPEED) / LIN_NUM_TICKS;
+        int digits = value >= 100 ? 3 : value >= 10 ? 2 : 1;
+        lin_labels[lin_num_labels].x = x - (digits * (CHAR_WIDTH + 1) - 1) / 2;
+        lin_labels[lin_num_labels].y = LIN_Y + LIN_LONG_TICK + LIN_LABEL_GAP;
+        lin_labels[lin_num_labels].value = value;
+        lin_num_labels++;
+    }
+}
+
+static void write_ticks(FILE *f, const char *name, const tick_t *t, int n){
+    int i;
+    fprintf(f, "\nconst gauge_tick_t %s[%d] = {", name, n);
+    for (i = 0; i < n; i++)
+        fprintf(f, "%s{%d, %d, %d, %d},", i % 4 ? " " : "\n    ", t[i].x0, t[i].y0, t[i].x1, t[i].y1);
+    fprintf(f, "\n};\n");
+}
+
+static void write_labels(FILE *f, const char *name, const label_t *l, int n){
+    int i;
+    fprintf(f, "\nconst gauge_label_t %s[%d] = {", name, n);
+    for (i = 0; i < n; i++)
+        fprintf(f, "%s{%d, %d, %d},", i % 4 ? " " : "\n    ", l[i].x, l[i].y, l[i].value);
+    fprintf(f, "\n};\n");
+}
+
+static bool write_needle(const char *c_path, const char *h_path){
+    FILE *f;
+    int i;
+
+    f = fopen(h_path, "w");
+    if (!f) { perror(h_path); return false; }
+    fprintf(f, "// Generated by host/gen_gauge.c (make -C project0/host tables) from gauge_layout.h, do not edit\n");
+    fprintf(f, "#ifndef NEEDLE_TABLE_H_\n#define NEEDLE_TABLE_H_\n\n#include <stdint.h>\n\n");
+    fprintf(f, "#define NEEDLE_TABLE_STEP %d       // Speed step per entry, in 1/100 km/h\n", NEEDLE_STEP);
+    fprintf(f, "#define NEEDLE_TABLE_SIZE %d     // Entries for 0..MAX_SPEED\n\n", NEEDLE_SIZE);
+    fprintf(f, "// Needle end point relative to the gauge center\n"
+               "typedef struct {\n    int16_t dx;\n    int16_t dy;\n} needle_point_t;\n\n");
+    fprintf(f, "extern const needle_point_t needle_table[NEEDLE_TABLE_SIZE];\n\n#endif\n");
+    fclose(f);
+
+    f = fopen(c_path, "w");
+    if (!f) { perror(c_path); return false; }
+    fprintf(f, "// Generated by host/gen_gauge.c (make -C project0/host tables) from gauge_layout.h, do not edit\n");
+    fprintf(f, "// NEEDLE_LENGTH %d, MAX_SPEED %g km/h, step %g km/h\n", NEEDLE_LENGTH, MAX_SPEED, NEEDLE_STEP / 100.0);
+    fprintf(f, "#include \"needle_table.h\"\n\n");
+    fprintf(f, "const needle_point_t needle_table[NEEDLE_TABLE_SIZE] = {");
+    for (i = 0; i < NEEDLE_SIZE; i++)
+        fprintf(f, "%s{%4d,%4d},", i % 8 ? " " : "\n    ", needle_dx[i], needle_dy[i]);
+    fprintf(f, "\n};\n");
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char **argv){
+    const char *c_path = argc > 4 ? argv[1] : "../gauge_tables.c";
+    const char *h_path = argc > 4 ? argv[2] : "../gauge_tables.h";
+    const char *needle_c_path = argc > 4 ? argv[3] : "../needle_table.c";
+    const char *needle_h_path = argc > 4 ? argv[4] : "../needle_table.h";
+    FILE *f;
+
+    arc_layout(CENTER_POINT_X, CENTER_POINT_Y);
+    needle_layout();
+    lin_layout();
+
+    f = fopen(h_path, "w");
+    if (!f) { perror(h_path); return 1; }
+    fprintf(f, "// Generated by host/gen_gauge.c (make -C project0/host tables) from gauge_layout.h, do not edit\n");
+    fprintf(f, "#ifndef GAUGE_TABLES_H_\n#define GAUGE_TABLES_H_\n\n#include <stdint.h>\n\n");
+    fprintf(f, "typedef struct {\n    int16_t x0, y0;     // outer end (arc), top (linear)\n"
+               "    int16_t x1, y1;\n} gauge_tick_t;\n\n");
+    fprintf(f, "typedef struct {\n    int16_t x, y;       // text anchor top left\n"
+               "    int16_t value;      // speed in km/h\n} gauge_label_t;\n\n");
+    fprintf(f, "#define ARC_NUM_TICKS %d\n#define ARC_NUM_LABELS %d\n", NUM_TICKS + 1, arc_num_labels);
+    fprintf(f, "#define LIN_NUM_TICKS_TOTAL %d\n#define LIN_NUM_LABELS %d\n\n", LIN_NUM_TICKS + 1, lin_num_labels);
+    fprintf(f, "extern const gauge_tick_t arc_ticks[ARC_NUM_TICKS];\n");
+    fprintf(f, "extern const gauge_label_t arc_labels[ARC_NUM_LABELS];\n");
+    fprintf(f, "extern const gauge_tick_t lin_ticks[LIN_NUM_TICKS_TOTAL];\n");
+    fprintf(f, "extern const gauge_label_t lin_labels[LIN_NUM_LABELS];\n\n#endif\n");
+    fclose(f);
+
+    f = fopen(c_path, "w");
+    if (!f) { perror(c_path); return 1; }
+    fprintf(f, "// Generated by host/gen_gauge.c (make -C project0/host tables) from gauge_layout.h, do not edit\n");
+    fprintf(f, "#include \"gauge_tables.h\"\n");
+    write_ticks(f, "arc_ticks", arc_ticks, NUM_TICKS + 1);
+    write_labels(f, "arc_labels", arc_labels, arc_num_labels);
+    write_ticks(f, "lin_ticks", lin_ticks, LIN_NUM_TICKS + 1);
+    write_labels(f, "lin_labels", lin_labels, lin_num_labels);
+    fclose(f);
+
+    if (!write_needle(needle_c_path, needle_h_path)) return 1;
+
+    printf("gauge tables: %d arc ticks, %d arc labels, %d linear ticks, %d linear labels, %d needle points\n",
+           NUM_TICKS + 1, arc_num_labels, LIN_NUM_TICKS + 1, lin_num_labels, NEEDLE_SIZE);
+    return 0;
+}
@@ -0,0 +1,154 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "display.h"
+#include "gauge_layout.h"
+#include "fixmath.h"
+#include "ssd1963_model.h"
+
+// Pixel check of the display layer against the SSD1963 model, run by "make check" once
+// per build flag set. The needle sweeps 0 -> 400 -> 0 km/h in 1 km/h steps at 50 Hz and
+// has to leave the screen exactly as it was at rest, any pixel left over from erasing
+// the needle or restoring the background counts. Arc style: the border band and the red
+// zone have to reach their end speeds, and the needle at MAX_SPEED has to point there.
+//
+//   needle_check [-s] [-w file | -c file]
+//     -s       draw every frame, the first one too, in short compose slices as the main loop does
+//     -w file  write the screen at rest as raw reference (0x00RRGGBB, row by row)
+//     -c file  compare the screen at rest against such a reference as well
+//
+// Exit status 1 on any differing pixel.
+
+#define SETTLE_FRAMES 60        // needle smoothing reaches its target well within these
+#define SLICE_BUDGET 2000       // host: ns per compose slice, several hundred slices per frame
+#define EDGE_KMH 1              // end points are probed this far inside / outside a band, clear of the ticks
+#define YELLOW 0xFFFF00         // colors of display.c
+#define RED 0xFF0000
+
+volatile bool warning_flag = false;     // owned by interrupt.c on the board
+
+static uint32_t screen[SSD1963_HEIGHT][SSD1963_WIDTH];
+static uint32_t ref[SSD1963_HEIGHT][SSD1963_WIDTH];
+static bool sliced = false;
+
+static void compose(uint32_t elapsed_ms){
+    if (sliced) {
+        display_compose_begin(elapsed_ms);
+        while (!display_compose_step(SLICE_BUDGET));
+    } else {
+        display_compose(elapsed_ms);
+        display_flush();
+    }
+}
+
+static void frame(uint32_t speed){
+    display_set_speed(speed);
+    compose(20);
+}
+
+static void grab(uint32_t image[SSD1963_HEIGHT][SSD1963_WIDTH]){
+    uint32_t x, y;
+    for (y = 0; y < SSD1963_HEIGHT; y++)
+        for (x = 0; x < SSD1963_WIDTH; x++) image[y][x] = ssd1963_pixel(x, y);
+}
+
+#if GAUGE_STYLE_ARC
+// Screen pixel at radius r on the gauge angle of speed (km/h), Q16.16 trig as gen_gauge.c
+static uint32_t arc_pixel(int r, int speed){
+    fix16_t angle = FIX16_CONST(ARC_START_TURNS) -
+                    (fix16_t)((int64_t)FIX16_CONST(ARC_SWEEP_TURNS) * speed / (int)MAX_SPEED);
+    return ssd1963_pixel(CENTER_POINT_X + fix16_to_int(r * fix16_cos_turns(angle)),
+                         CENTER_POINT_Y + fix16_to_int(-r * fix16_sin_turns(angle)));
+}
+
+static uint32_t expect(const char *what, int r, int speed, uint32_t color, bool is){
+    uint32_t pixel = arc_pixel(r, speed);
+    if ((pixel == color) == is) return 0;
+    printf("  %s at %d km/h: %06x\n", what, speed, pixel);
+    return 1;
+}
+
+// Bands end where the ticks and the needle end, checked on the screen at rest
+static uint32_t band_ends(void){
+    const int border = OUTER_ARC_RAD + BORDER_WIDTH / 2, red = INNER_ARC_RAD + RED_ZONE_WIDTH / 2;
+    uint32_t n = 0;
+    n += expect("border band missing", border, EDGE_KMH, YELLOW, true);
+    n += expect("border band missing", border, (int)MAX_SPEED - EDGE_KMH, YELLOW, true);
+    n += expect("red zone missing", red, RED_ZONE_SPEED + EDGE_KMH, RED, true);
+    n += expect("red zone missing", red, (int)MAX_SPEED - EDGE_KMH, RED, true);
+    n += expect("red zone before RED_ZONE_SPEED", red, RED_ZONE_SPEED - EDGE_KMH, RED, false);
+    return n;
+}
+#endif
+
+static uint32_t differing(void){
+    uint32_t x, y, n = 0;
+    for (y = 0; y < SSD1963_HEIGHT; y++)
+        for (x = 0; x < SSD1963_WIDTH; x++)
+            if (screen[y][x] != ref[y][x]) {
+                if (n == 0) printf("  first at %u,%u: %06x, expected %06x\n", x, y, screen[y][x], ref[y][x]);
+                n++;
+            }
+    return n;
+}
+
+int main(int argc, char **argv){
+    const char *write_path = 0, *compare_path = 0;
+    uint32_t diff, failed = 0;
+    FILE *f;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-s")) sliced = true;
+        else if (!strcmp(argv[i], "-w") && i + 1 < argc) write_path = argv[++i];
+        else if (!strcmp(argv[i], "-c") && i + 1 < argc) compare_path = argv[++i];
+        else { fprintf(stderr, "usage: %s [-s] [-w file | -c file]\n", argv[0]); return 2; }
+    }
+
+    init_ports_display();
+    display_init_start();
+    while (!display_init_poll());
+    display_ui_init();
+    compose(0);             // dial and every widget, sliced with -s as at boot
+    for (i = 0; i < SETTLE_FRAMES; i++) frame(0);
+    grab(screen);
+
+    if (write_path) {
+        f = fopen(write_path, "wb");
+        if (!f || fwrite(screen, sizeof(screen), 1, f) != 1) { fprintf(stderr, "could not write %s\n", write_path); return 2; }
+        fclose(f);
+    }
+    if (compare_path) {
+        f = fopen(compare_path, "rb");
+        if (!f || fread(ref, sizeof(ref), 1, f) != 1) { fprintf(stderr, "could not read %s\n", compare_path); return 2; }
+        fclose(f);
+        diff = differing();
+        printf("screen at rest vs %s: %u differing pixels\n", compare_path, diff);
+        failed += diff;
+    }
+
+#if GAUGE_STYLE_ARC
+    diff = band_ends();
+    printf("band end points: %u wrong\n", diff);
+    failed += diff;
+#endif
+
+    memcpy(ref, screen, sizeof(ref));
+    for (i = 0; i <= 400; i++) frame(i * 100);
+    for (i = 0; i < SETTLE_FRAMES; i++) frame(40000);
+#if GAUGE_STYLE_ARC
+    diff = expect("needle missing", NEEDLE_LENGTH / 2, (int)MAX_SPEED, YELLOW, true);
+    printf("needle end point: %u wrong\n", diff);
+    failed += diff;
+#endif
+    for (i = 400; i >= 0; i--) frame(i * 100);
+    for (i = 0; i < SETTLE_FRAMES; i++) frame(0);
+    grab(screen);
+    diff = differing();
+    printf("needle sweep%s: %u differing pixels\n", sliced ? " in slices" : "", diff);
+    failed += diff;
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,109 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "png_write.h"
+
+// Minimal PNG encoder: zlib stream made of stored (uncompressed) deflate blocks,
+// so no zlib dependency is needed for the host build.
+
+static uint32_t crc_table[256];
+
+static void crc_init(void){
+    uint32_t n, k;
+    for (n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        crc_table[n] = c;
+    }
+}
+
+static uint32_t crc_update(uint32_t crc, const uint8_t *buf, size_t len){
+    size_t i;
+    for (i = 0; i < len; i++) crc = crc_table[(crc ^ buf[i]) & 0xFF] ^ (crc >> 8);
+    return crc;
+}
+
+static void put_be32(uint8_t *p, uint32_t v){
+    p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v;
+}
+
+static void write_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t len){
+    uint8_t hdr[8];
+    uint8_t tail[4];
+    uint32_t crc;
+
+    put_be32(hdr, len);
+    hdr[4] = type[0]; hdr[5] = type[1]; hdr[6] = type[2]; hdr[7] = type[3];
+    crc = crc_update(0xFFFFFFFFu, hdr + 4, 4);
+    crc = crc_update(crc, data, len) ^ 0xFFFFFFFFu;
+    put_be32(tail, crc);
+
+    fwrite(hdr, 1, 8, f);
+    if (len) fwrite(data, 1, len, f);
+    fwrite(tail, 1, 4, f);
+}
+
+bool png_write_rgb(const char *path, const uint32_t *pixels, uint32_t width, uint32_t height){
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    uint32_t stride = width * 3 + 1;    // filter byte + RGB
+    size_t raw_len = (size_t)stride * height;
+    size_t blocks = (raw_len + 65534) / 65535;
+    size_t idat_len = 2 + raw_len + blocks * 5 + 4;
+    uint8_t *raw, *idat, *p;
+    uint8_t ihdr[13];
+    uint32_t a = 1, b = 0;              // adler32
+    size_t i, off;
+    uint32_t x, y;
+    FILE *f;
+
+    raw = malloc(raw_len);
+    idat = malloc(idat_len);
+    if (!raw || !idat) { free(raw); free(idat); return false; }
+
+    // scanlines with filter type 0
+    p = raw;
+    for (y = 0; y < height; y++) {
+        *p++ = 0;
+        for (x = 0; x < width; x++) {
+            uint32_t c = pixels[y * width + x];
+            *p++ = c >> 16; *p++ = c >> 8; *p++ = c;
+        }
+    }
+    for (i = 0; i < raw_len; i++) {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+
+    // zlib header, stored blocks, adler32
+    p = idat;
+    *p++ = 0x78; *p++ = 0x01;
+    for (off = 0; off < raw_len; off += 65535) {
+        size_t n = raw_len - off < 65535 ? raw_len - off : 65535;
+        *p++ = (off + n == raw_len) ? 1 : 0;   // BFINAL on the last block
+        *p++ = n & 0xFF; *p++ = n >> 8;
+        *p++ = ~n & 0xFF; *p++ = (~n >> 8) & 0xFF;
+        for (i = 0; i < n; i++) *p++ = raw[off + i];
+    }
+    put_be32(p, (b << 16) | a);
+
+    put_be32(ihdr, width);
+    put_be32(ihdr + 4, height);
+    ihdr[8] = 8;    // bit depth
+    ihdr[9] = 2;    // truecolor
+    ihdr[10] = 0; ihdr[11] = 0; ihdr[12] = 0;
+
+    f = fopen(path, "wb");
+    if (f) {
+        crc_init();
+        fwrite(signature, 1, sizeof(signature), f);
+        write_chunk(f, "IHDR", ihdr, sizeof(ihdr));
+        write_chunk(f, "IDAT", idat, (uint32_t)idat_len);
+        write_chunk(f, "IEND", NULL, 0);
+        fclose(f);
+    }
+    free(raw);
+    free(idat);
+    return f != NULL;
+}
@@ -0,0 +1,10 @@
+#ifndef PNG_WRITE_H_
+#define PNG_WRITE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Write 0x00RRGGBB pixels as an uncompressed 8 bit RGB PNG
+bool png_write_rgb(const char *path, const uint32_t *pixels, uint32_t width, uint32_t height);
+
+#endif
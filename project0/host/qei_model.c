@@ -0,0 +1,59 @@
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "qei_model.h"
+
+/********************************************************************************/
+// Model state
+/********************************************************************************/
+static uint32_t ctl = 0, stat = 0, pos = 0, maxpos = 0, ris = 0;
+static bool prev_a = false, prev_b = false;
+
+/********************************************************************************/
+uint32_t qei_model_read(uint32_t reg){
+    switch (reg) {
+    case QEI_O_CTL: return ctl;
+    case QEI_O_STAT: return stat;
+    case QEI_O_POS: return pos;
+    case QEI_O_MAXPOS: return maxpos;
+    case QEI_O_RIS: return ris;
+    default: return 0;
+    }
+}
+
+void qei_model_write(uint32_t reg, uint32_t value){
+    switch (reg) {
+    case QEI_O_CTL: ctl = value; break;
+    case QEI_O_POS: pos = value; break;
+    case QEI_O_MAXPOS: maxpos = value; break;
+    case QEI_O_ISC: ris &= ~value; break;   // write 1 to clear
+    default: break;     // STAT and RIS are read only
+    }
+}
+
+void qei_model_input(bool pha, bool phb){
+    bool a = (ctl & QEI_CTL_SWAP) ? phb : pha;
+    bool b = (ctl & QEI_CTL_SWAP) ? pha : phb;
+    bool da = a != prev_a, db = b != prev_b;
+    bool forwards;
+
+    prev_a = a;
+    prev_b = b;
+    if (!(ctl & QEI_CTL_ENABLE) || (!da && !db)) return;
+    if (da && db) {             // skipped a state, no direction
+        stat |= QEI_STAT_ERROR;
+        ris |= QEI_INTERROR;
+        return;
+    }
+    if (db && !(ctl & QEI_CTL_CAPMODE)) return;    // PhA edges only
+
+    // PhA leads PhB: forwards, the counter goes up
+    forwards = da ? a != b : a == b;
+    if (forwards) {
+        pos = pos == maxpos ? 0 : pos + 1;
+        stat &= ~QEI_STAT_DIRECTION;
+    } else {
+        pos = pos == 0 ? maxpos : pos - 1;
+        stat |= QEI_STAT_DIRECTION;
+    }
+}
@@ -0,0 +1,30 @@
+#ifndef QEI_MODEL_H_
+#define QEI_MODEL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Software model of the QEI0 register interface for the HOST_BUILD, fed with the
+// S1/S2 levels of an edge trace. Quadrature mode with position counter and direction
+// bit; clock/direction mode, index and velocity capture are not modeled.
+
+// Register offsets and bits as in TivaWare inc/hw_qei.h
+#define QEI_O_CTL 0x00000000
+#define QEI_O_STAT 0x00000004
+#define QEI_O_POS 0x00000008
+#define QEI_O_MAXPOS 0x0000000C
+#define QEI_O_RIS 0x00000024
+#define QEI_O_ISC 0x00000028
+
+#define QEI_CTL_ENABLE 0x00000001
+#define QEI_CTL_SWAP 0x00000002
+#define QEI_CTL_CAPMODE 0x00000008     // count PhB edges as well
+#define QEI_STAT_ERROR 0x00000001      // both phases changed at once
+#define QEI_STAT_DIRECTION 0x00000002  // 1: reverse
+#define QEI_INTERROR 0x00000008        // RIS/ISC: phase error
+
+uint32_t qei_model_read(uint32_t reg);
+void qei_model_write(uint32_t reg, uint32_t value);
+void qei_model_input(bool pha, bool phb);  // levels after an edge on PhA0/PhB0
+
+#endif
@@ -0,0 +1,150 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "ssd1963_model.h"
+#include "png_write.h"
+#include "display_bus.h"
+
+// Commands understood by the model, everything else only swallows its parameters
+#define CMD_SOFT_RESET 0x01
+#define CMD_SET_COLUMN 0x2A
+#define CMD_SET_PAGE 0x2B
+#define CMD_WRITE_MEMORY_START 0x2C
+#define CMD_WRITE_MEMORY_CONTINUE 0x3C
+#define CMD_SET_PIXEL_DATA_FORMAT 0xF0
+
+/********************************************************************************/
+// Model state
+/********************************************************************************/
+static uint32_t image[SSD1963_HEIGHT][SSD1963_WIDTH];
+static uint8_t command = 0;         // last command byte
+static uint32_t param = 0;          // parameter index since the last command
+static uint8_t args[4];
+
+static uint32_t sc = 0, ec = SSD1963_WIDTH - 1;     // column window (x)
+static uint32_t sp = 0, ep = SSD1963_HEIGHT - 1;    // page window (y)
+static uint32_t cur_x = 0, cur_y = 0;               // write pointer
+static uint8_t pixel_format = 0;    // 0x00: 8 bit bus, 3 bytes per pixel
+static uint8_t rgb[3];
+static uint32_t rgb_count = 0;
+
+static uint32_t n_commands = 0, n_data = 0, n_pixels = 0;
+
+/********************************************************************************/
+// Memory write
+/********************************************************************************/
+static void put_pixel(uint32_t color){
+    // Out-of-panel windows are accepted but not stored, like on the real controller
+    if (cur_x < SSD1963_WIDTH && cur_y < SSD1963_HEIGHT) image[cur_y][cur_x] = color;
+    n_pixels++;
+
+    // column first, then page, wrapping inside the window
+    if (++cur_x > ec) {
+        cur_x = sc;
+        if (++cur_y > ep) cur_y = sp;
+    }
+}
+
+static void memory_data(uint8_t data){
+    if (pixel_format != 0x00) return;   // only the 8 bit interface is wired on the board
+
+    rgb[rgb_count++] = data;
+    if (rgb_count == 3) {
+        put_pixel(((uint32_t)rgb[0] << 16) | ((uint32_t)rgb[1] << 8) | rgb[2]);
+        rgb_count = 0;
+    }
+}
+
+/********************************************************************************/
+// Bus interface
+/********************************************************************************/
+void ssd1963_write_command(uint8_t cmd){
+    n_commands++;
+    command = cmd;
+    param = 0;
+    rgb_count = 0;
+
+    switch (cmd) {
+    case CMD_WRITE_MEMORY_START:    // restart at the window origin
+        cur_x = sc;
+        cur_y = sp;
+        break;
+    case CMD_SOFT_RESET:
+        sc = 0; ec = SSD1963_WIDTH - 1;
+        sp = 0; ep = SSD1963_HEIGHT - 1;
+        cur_x = cur_y = 0;
+        break;
+    default:
+        break;
+    }
+}
+
+void ssd1963_write_data(uint8_t data){
+    n_data++;
+
+    switch (command) {
+    case CMD_SET_COLUMN:
+    case CMD_SET_PAGE:
+        if (param < 4) args[param] = data;
+        if (param == 3) {
+            uint32_t start = ((uint32_t)args[0] << 8) | args[1];
+            uint32_t end = ((uint32_t)args[2] << 8) | args[3];
+            if (command == CMD_SET_COLUMN) { sc = start; ec = end; }
+            else { sp = start; ep = end; }
+        }
+        break;
+    case CMD_WRITE_MEMORY_START:
+    case CMD_WRITE_MEMORY_CONTINUE:
+        memory_data(data);
+        break;
+    case CMD_SET_PIXEL_DATA_FORMAT:
+        if (param == 0) pixel_format = data & 0x07;
+        break;
+    default:
+        break;
+    }
+    param++;
+}
+
+void ssd1963_hw_reset(bool active){
+    if (active) ssd1963_write_command(CMD_SOFT_RESET);
+}
+
+void ssd1963_reset_counters(void){
+    n_commands = n_data = n_pixels = 0;
+}
+
+uint32_t ssd1963_commands(void){ return n_commands; }
+uint32_t ssd1963_data(void){ return n_data; }
+uint32_t ssd1963_pixels(void){ return n_pixels; }
+
+uint32_t ssd1963_pixel(uint32_t x, uint32_t y){
+    return image[y][x];
+}
+
+bool ssd1963_dump_png(const char *path){
+    return png_write_rgb(path, &image[0][0], SSD1963_WIDTH, SSD1963_HEIGHT);
+}
+
+/********************************************************************************/
+// Bus HAL for the host build (see display_bus.h)
+/********************************************************************************/
+uint8_t bus_port_m = 0;
+uint32_t bus_gpio_stores = 0;
+
+void bus_init(void){
+}
+
+void bus_reset(bool active){
+    ssd1963_hw_reset(active);
+}
+
+void bus_wait_start(uint32_t us){
+    (void)us;
+}
+
+bool bus_wait_done(void){
+    return true;
+}
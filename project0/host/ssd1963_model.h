@@ -0,0 +1,27 @@
+#ifndef SSD1963_MODEL_H_
+#define SSD1963_MODEL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Software model of the SSD1963 as wired on the board (8 bit bus, 24 bit color)
+// for the HOST_BUILD. It renders into an 800x480 RGB image and counts strobes.
+
+#define SSD1963_WIDTH 800
+#define SSD1963_HEIGHT 480
+
+void ssd1963_write_command(uint8_t command);
+void ssd1963_write_data(uint8_t data);
+void ssd1963_hw_reset(bool active);
+
+// Strobe counters since the last ssd1963_reset_counters()
+void ssd1963_reset_counters(void);
+uint32_t ssd1963_commands(void);
+uint32_t ssd1963_data(void);
+uint32_t ssd1963_pixels(void);
+
+// Rendered image, logical coordinates as addressed by display.c (0x00RRGGBB)
+uint32_t ssd1963_pixel(uint32_t x, uint32_t y);
+bool ssd1963_dump_png(const char *path);
+
+#endif
@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 #include "inc/hw_types.h"
 #include "inc/hw_memmap.h"
 #include "driverlib/sysctl.h"
@@ -8,36 +9,79 @@
 #include "utils/uartstdio.h"
 #include "driverlib/timer.h"
 #include "inc/hw_ints.h"
+#include "inc/hw_gpio.h"
 
 #include "interrupt.h"
+#include "fixmath.h"
+#include "frame_timing.h"
+#include "cycles.h"
+#include "quadrature.h"
+#include "speed.h"
+#if USE_QEI
+#include "driverlib/pin_map.h"
+#include "display_bus.h"    // BUS_CTRL_PINS
+#if BUS_CTRL_PINS & (GPIO_PIN_1 | GPIO_PIN_2)
+#error "USE_QEI needs PL1/PL2 (PhA0/PhB0), the SSD1963 control lines are still on them"
+#endif
+#endif
 
 // Macros 
 #define MOTOR_S1 GPIO_PIN_0
 #define MOTOR_S2 GPIO_PIN_1
 #define MOTOR_PORT GPIO_PORTP_BASE
-#define WINDOW_PERIOD 100   // millisecond
-//#define CIRCUMFERENCE 0.444f // Circumference of motor wheel on the board, adjust according to max speed!
-#define CIRCUMFERENCE 0.6f
+#define MOTOR_STATE (MOTOR_PORT + GPIO_O_DATA + ((MOTOR_S1 | MOTOR_S2) << 2))   // masked data: S1 | S2 << 1
+#define MAX_DISTANCE 999990000u // mm, odometer shows 999,99 km
+
+#ifndef ZERO_SPEED_TIMEOUT_MS
+#define ZERO_SPEED_TIMEOUT_MS 500   // no S1 edge for this long: standstill
+#endif
+#define ZERO_SPEED_TIMEOUT (window_timer_period / WINDOW_MS * ZERO_SPEED_TIMEOUT_MS)   // cycles
+
+#ifndef PRINT_EVERY
+#define PRINT_EVERY SUB_WINDOWS     // UART line every this many speed updates, once per window
+#endif
 
 // Global variables
-volatile uint32_t edgeCountWindowS1 = 0; // Number of pulses in this time frame
-volatile float rpm = 0.0f;
+volatile uint32_t rpm = 0;
 volatile bool directionForwards = true;
-volatile bool prevS1 = false, prevS2 = false, thisS1 = false, thisS2 = false; // Signal flag for direction calculation
-volatile uint32_t count = 0;
+volatile uint32_t count = 0;       // quadrature steps in the last WINDOW_MS, 4 per S1 period
+static uint32_t illegal_total = 0;  // S1/S2 transitions that skipped a state, signal quality
 volatile uint32_t speed = 0;
 volatile bool calc_flag = false;
-volatile float distance_total = 0.0f;
+volatile uint32_t distance_total = 0; // mm
+static fix16_t distance_rest = 0;   // below 1 mm, carried into the next sub-window
 bool max_dist_reached = false;
 volatile bool warning_flag = false;
 static bool warning_active = false;
 
+static quad_window_t window;    // S1/S2 decoded over the last WINDOW_MS, see quadrature.h
+static quad_window_t sub_windows[SUB_WINDOWS];  // ring of the sub-windows summed in window
+static uint32_t sub_next = 0;                   // oldest sub-window, replaced next
+static volatile uint32_t sub_count = 0;         // sub-windows since start, from the timer ISR
+static uint32_t sub_done = 0;                   // sub_count at the last calc_speed_dir()
+static uint32_t print_count = 0;
+
 // CMSIS Functions?
 // SystickPeriodSet
 // SysTickIntRegister
 // SysTickIntEnable
 // IntMasterEnable
 
+#if USE_QEI
+// S1/S2 on QEI0 PhA0/PhB0 (PL1/PL2), decoded in hardware without edge interrupts
+void init_motor_ports_interrupts(void){
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOL);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOL)){};
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_QEI0);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_QEI0)){};
+
+    GPIOPinConfigure(GPIO_PL1_PHA0);
+    GPIOPinConfigure(GPIO_PL2_PHB0);
+    GPIOPinTypeQEI(GPIO_PORTL_BASE, GPIO_PIN_1 | GPIO_PIN_2);
+
+    quad_qei_init();
+}
+#else
 // Inputs from motors at Port P
 void init_motor_ports_interrupts(void){
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOP);
@@ -52,53 +96,42 @@ void init_motor_ports_interrupts(void){
     // Clear pending interrupts
     GPIOIntClear(MOTOR_PORT, GPIOIntStatus(MOTOR_PORT, false)); 
 
-    // Define Interupt handler for this PORT 
-    GPIOIntRegister(MOTOR_PORT, motor_interrupt_handler); // NOTE: function pointer passed, not function itself!
+    // Start the decoder from the current levels, not from 00
+    quad_gpio_init(HWREG(MOTOR_STATE));
+
+    // One vector per pin on Port P: S1 on P0, S2 on P1
+    IntRegister(INT_GPIOP0, motor_s1_interrupt_handler);
+    IntRegister(INT_GPIOP1, motor_s2_interrupt_handler);
 
     // Enable interrupt
     GPIOIntEnable(MOTOR_PORT, MOTOR_S1|MOTOR_S2);
 
-    // NVIC on Port P0 aka. signal S1
-    IntEnable(INT_GPIOP0);
+    // NVIC on Port P0 / P1 aka. signal S1 / S2
     IntPrioritySet(INT_GPIOP0, 0x0); // Prio 1 (Most sig. 3 bits)
-
+    IntPrioritySet(INT_GPIOP1, 0x0);
+    IntEnable(INT_GPIOP0);
+    IntEnable(INT_GPIOP1);
 }
 
-void motor_interrupt_handler(){
-    // Read the Raw Interrupt Status directly
-    // Get current interrupt status, masked interrupt to prevent triggering during handler
-    uint32_t stat = GPIOIntStatus(MOTOR_PORT,true);     
-
-    if (stat & MOTOR_S1){   // Interrupt by s1
-        if(GPIOPinRead(MOTOR_PORT, MOTOR_S1)){  // Rising edge
-            edgeCountWindowS1++;
-            thisS1 = true;
-        } else thisS1 = false;  // Falling edge
-    } else {
-        if(GPIOPinRead(MOTOR_PORT, MOTOR_S2)){  // Rising edge 
-            thisS2 = true;
-        } else thisS2 = false;  // Falling edge
-    }
-
-    GPIOIntClear(MOTOR_PORT, stat);    // Clear current interrupt
-
-    if(((prevS1 == true && thisS1 == false) && (prevS2 == true && thisS2 == true)) ||
-        ((prevS1 == false  && thisS1 == false) && (prevS2 == true && thisS2 == false)) ||
-        ((prevS1 == false  && thisS1 == true) && (prevS2 == false && thisS2 == false)) ||
-        ((prevS1 == true  && thisS1 == true) && (prevS2 == false && thisS2 == true)) ){
-            directionForwards = true;
-    } else directionForwards = false;
+// Edge on S1 / S2: the vector already says which pin, the levels go to the decoder as they are.
+// Cleared first, an edge that comes in while the handler runs raises it again.
+void motor_s1_interrupt_handler(void){
+    HWREG(MOTOR_PORT + GPIO_O_ICR) = MOTOR_S1;
+    quad_gpio_edge(HWREG(MOTOR_STATE), cycles_now());
+}
 
-    prevS1 = thisS1;
-    prevS2 = thisS2;
+void motor_s2_interrupt_handler(void){
+    HWREG(MOTOR_PORT + GPIO_O_ICR) = MOTOR_S2;
+    quad_gpio_edge(HWREG(MOTOR_STATE), cycles_now());
 }
+#endif
 
 // Periodic timer with interrupt
 void init_timer_interrupt(void){
     TimerDisable(TIMER0_BASE, TIMER_A);
 
     TimerConfigure(TIMER0_BASE, TIMER_CFG_PERIODIC);
-    TimerLoadSet(TIMER0_BASE, TIMER_A, window_timer_period - 1);
+    TimerLoadSet(TIMER0_BASE, TIMER_A, window_timer_period / SUB_WINDOWS - 1);  // one sub-window
 
     // Register interrupt
     TimerIntRegister(TIMER0_BASE, TIMER_A, timer_interrupt_handler);
@@ -114,14 +147,32 @@ void init_timer_interrupt(void){
     TimerEnable(TIMER0_BASE, TIMER_A);
 }
 
-// Once the window period of 100 ms has been reached, timer interrupt !
+// Once a sub-window of 10 ms has been reached, timer interrupt !
+// The sub-window replaces the oldest one in the ring, window is the sum over the last 100 ms.
 void timer_interrupt_handler(void){
+    quad_window_t sub;
+
     // Clear interrupt flag 
     TimerIntClear(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
-    count = edgeCountWindowS1;
 
-    edgeCountWindowS1 = 0;
+#if USE_QEI
+    quad_qei_window(&sub);
+#else
+    IntMasterDisable();     // the edge ISR has the higher priority, take all values of one sub-window
+    quad_gpio_window(&sub, cycles_now(), ZERO_SPEED_TIMEOUT);
+    IntMasterEnable();
+#endif
+    quad_window_slide(&window, &sub, &sub_windows[sub_next]);
+    sub_windows[sub_next] = sub;
+    sub_next = (sub_next + 1) % SUB_WINDOWS;
+    sub_count++;
+
+    count = window.steps;
+    directionForwards = window.forwards;
+    illegal_total += sub.illegal;
+
     calc_flag = true;
+    frame_calc_stamp();     // calc_speed_dir() delay, see frame_stats_print()
 }
 
 void display_timer_interrupt(void){
@@ -147,6 +198,7 @@ void display_timer_interrupt(void){
 void display_interrupt_handler(void){
     // Clear interrupt flag 
     TimerIntClear(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
+    if (update_display) frame_tick_merged();   // last tick not consumed yet
     update_display = true;
 }
 
@@ -185,12 +237,44 @@ void cancel_warning_timer(void) {
 }
 
 
-void calc_speed_dir(){ // triggers every 100ms
-    rpm = (count / 0.1f ) * (60.0f / 2.0f); // number of revolutions per minute, 
-    float speed_f = rpm * CIRCUMFERENCE * 0.06f;    // taking average within 100ms
+// Drops everything measured so far, after edge_bench.c has pended the window ISR by hand
+void speed_window_reset(void){
+    quad_window_t discard;
+
+    IntMasterDisable();
+#if USE_QEI
+    quad_qei_window(&discard);
+#else
+    quad_gpio_window(&discard, cycles_now(), 0);    // no period across the reset either
+#endif
+    memset(sub_windows, 0, sizeof(sub_windows));
+    memset(&window, 0, sizeof(window));
+    sub_next = 0;
+    sub_count = 0;
+    sub_done = 0;
+    count = 0;
+    illegal_total = 0;
+    calc_flag = false;
+    IntMasterEnable();
+}
+
+void calc_speed_dir(){ // triggers every 10ms, average over the last 100ms
+    quad_window_t now;
+    uint32_t subs;
 
-    int rpm_i = (int)rpm;
-    speed = (int)(speed_f * 100); // for two decimals in kmh !!100 MULTIPLE HERE!!
+    // Take the window of one sub-window, the window ISR may slide it meanwhile. A slide
+    // after this point sets calc_flag again and is picked up by the next call.
+    calc_flag = false;
+    IntMasterDisable();
+    now = window;
+    subs = sub_count - sub_done;
+    IntMasterEnable();
+
+    fix16_t edges = quad_edges(&now, window_timer_period, ZERO_SPEED_TIMEOUT);
+    rpm = speed_rpm(edges); // number of revolutions per minute, 
+    fix16_t speed_f = speed_kmh(edges);     // km/h, see speed.c for the wheel
+
+    speed = fix16_mul_int(speed_f, 100); // for two decimals in kmh !!100 MULTIPLE HERE!!
 
     // IF timer hits 400 kmh(MAX SPEED), start
     if (warning_flag == false){
@@ -218,29 +302,32 @@ void calc_speed_dir(){ // triggers every 100ms
         }
     }
 
-    // Calculate distance travelled
-    float delta_distance = 0;
-    delta_distance = (speed_f / 3600.0f) * 0.1f;  //km
+    // Calculate distance travelled since the last call, normally one sub-window (more if
+    // calc_flag was still set), the mm fraction carries over
+    sub_done += subs;
+    uint32_t delta_distance = speed_distance_mm(speed_f, subs, &distance_rest);
     
     if (!max_dist_reached) {  // only able to set this back to 0 with reset
-        if (distance_total >= 999.99) {
+        if (distance_total + delta_distance >= MAX_DISTANCE) {
             max_dist_reached = true;
-            distance_total = 999.99;
+            distance_total = MAX_DISTANCE;
         } else distance_total += delta_distance; 
     }
 
-    int distance_int = (int)distance_total;                // whole km
-    int distance_frac = (int)((distance_total - distance_int) * 100); // two decimals
-
-    // debug
-    UARTprintf( "RPM: %d, Speed: %d.%02d km/h, Direction: %s, Distance: %03d,%02d km\n",
-        rpm_i,
-        speed / 100,
-        speed % 100,
-        directionForwards ? "V" : "R",
-        distance_int,
-        distance_frac);
-
-    // Reset my calculation begin flag
-    calc_flag = false;
+    // debug, at most once per window: a line takes longer than a sub-window on the UART
+    if (++print_count >= PRINT_EVERY) {
+        int distance_int = distance_total / 1000000;           // whole km
+        int distance_frac = (distance_total / 10000) % 100;    // two decimals
+
+        print_count = 0;
+        UARTprintf( "RPM: %d, Speed: %d.%02d km/h, Direction: %s, Distance: %03d,%02d km, Position: %d, Illegal: %u\n",
+            rpm,
+            speed / 100,
+            speed % 100,
+            directionForwards ? "V" : "R",
+            distance_int,
+            distance_frac,
+            now.position,
+            illegal_total);
+    }
 }
@@ -4,22 +4,35 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+// Speed window: Timer0 fires every SUB_WINDOW_MS and the speed is the sum over the last
+// SUB_WINDOWS sub-windows, a fresh WINDOW_MS average every SUB_WINDOW_MS
+#ifndef SUB_WINDOW_MS
+#define SUB_WINDOW_MS 10
+#endif
+#ifndef SUB_WINDOWS
+#define SUB_WINDOWS 10
+#endif
+#define WINDOW_MS (SUB_WINDOW_MS * SUB_WINDOWS)     // keep 1000 a multiple of it
+#define DISPLAY_WINDOW_MS 20    // Timer1 display tick
+
 // Prototype declarations
 void init_motor_ports_interrupts(void);
-void motor_interrupt_handler(void);
+void motor_s1_interrupt_handler(void);  // GPIO backend only, see quadrature.h
+void motor_s2_interrupt_handler(void);
 void init_timer_interrupt(void);
 void timer_interrupt_handler(void);
 void calc_speed_dir(void);
+void speed_window_reset(void);      // empty sub-window ring and no pending calc_flag, as at start
 void display_timer_interrupt(void);
 void display_interrupt_handler(void);
 
 
 // Variable declarations
-extern volatile float rpm;
+extern volatile uint32_t rpm;
 extern volatile bool directionForwards;
 extern volatile uint32_t speed;
-extern volatile float distance_total;
-extern uint32_t window_timer_period;
+extern volatile uint32_t distance_total;   // mm
+extern uint32_t window_timer_period;    // WINDOW_MS in cycles, Timer0 runs SUB_WINDOWS times as often
 extern uint32_t display_timer_period;
 extern uint32_t warning_timer_period;
 extern volatile bool calc_flag;
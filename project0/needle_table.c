@@ -0,0 +1,207 @@
+// Generated by host/gen_gauge.c (make -C project0/host tables) from gauge_layout.h, do not edit
+// NEEDLE_LENGTH 245, MAX_SPEED 400 km/h, step 0.25 km/h
+#include "needle_table.h"
+
+const needle_point_t needle_table[NEEDLE_TABLE_SIZE] = {
+    {-174, 173}, {-174, 172}, {-175, 172}, {-175, 171}, {-176, 171}, {-176, 170}, {-177, 170}, {-177, 169},
+    {-178, 169}, {-178, 168}, {-179, 168}, {-179, 167}, {-180, 167}, {-180, 166}, {-181, 165}, {-181, 165},
+    {-182, 164}, {-182, 164}, {-183, 163}, {-183, 163}, {-184, 162}, {-184, 162}, {-185, 161}, {-185, 161},
+    {-186, 160}, {-186, 160}, {-186, 159}, {-187, 158}, {-187, 158}, {-188, 157}, {-188, 157}, {-189, 156},
+    {-189, 156}, {-190, 155}, {-190, 155}, {-191, 154}, {-191, 153}, {-192, 153}, {-192, 152}, {-192, 152},
+    {-193, 151}, {-193, 151}, {-194, 150}, {-194, 149}, {-195, 149}, {-195, 148}, {-196, 148}, {-196, 147},
+    {-196, 147}, {-197, 146}, {-197, 145}, {-198, 145}, {-198, 144}, {-199, 144}, {-199, 143}, {-199, 143},
+    {-200, 142}, {-200, 141}, {-201, 141}, {-201, 140}, {-201, 140}, {-202, 139}, {-202, 138}, {-203, 138},
+    {-203, 137}, {-204, 137}, {-204, 136}, {-204, 135}, {-205, 135}, {-205, 134}, {-206, 134}, {-206, 133},
+    {-206, 132}, {-207, 132}, {-207, 131}, {-207, 131}, {-208, 130}, {-208, 129}, {-209, 129}, {-209, 128},
+    {-209, 128}, {-210, 127}, {-210, 126}, {-211, 126}, {-211, 125}, {-211, 124}, {-212, 124}, {-212, 123},
+    {-212, 123}, {-213, 122}, {-213, 121}, {-213, 121}, {-214, 120}, {-214, 119}, {-214, 119}, {-215, 118},
+    {-215, 118}, {-216, 117}, {-216, 116}, {-216, 116}, {-217, 115}, {-217, 114}, {-217, 114}, {-218, 113},
+    {-218, 112}, {-218, 112}, {-219, 111}, {-219, 111}, {-219, 110}, {-220, 109}, {-220, 109}, {-220, 108},
+    {-221, 107}, {-221, 107}, {-221, 106}, {-221, 105}, {-222, 105}, {-222, 104}, {-222, 103}, {-223, 103},
+    {-223, 102}, {-223, 101}, {-224, 101}, {-224, 100}, {-224,  99}, {-224,  99}, {-225,  98}, {-225,  97},
+    {-225,  97}, {-226,  96}, {-226,  95}, {-226,  95}, {-226,  94}, {-227,  93}, {-227,  93}, {-227,  92},
+    {-228,  91}, {-228,  91}, {-228,  90}, {-228,  89}, {-229,  89}, {-229,  88}, {-229,  87}, {-229,  87},
+    {-230,  86}, {-230,  85}, {-230,  85}, {-230,  84}, {-231,  83}, {-231,  83}, {-231,  82}, {-231,  81},
+    {-232,  81}, {-232,  80}, {-232,  79}, {-232,  79}, {-233,  78}, {-233,  77}, {-233,  77}, {-233,  76},
+    {-234,  75}, {-234,  75}, {-234,  74}, {-234,  73}, {-234,  72}, {-235,  72}, {-235,  71}, {-235,  70},
+    {-235,  70}, {-235,  69}, {-236,  68}, {-236,  68}, {-236,  67}, {-236,  66}, {-236,  66}, {-237,  65},
+    {-237,  64}, {-237,  63}, {-237,  63}, {-237,  62}, {-238,  61}, {-238,  61}, {-238,  60}, {-238,  59},
+    {-238,  59}, {-238,  58}, {-239,  57}, {-239,  56}, {-239,  56}, {-239,  55}, {-239,  54}, {-239,  54},
+    {-240,  53}, {-240,  52}, {-240,  52}, {-240,  51}, {-240,  50}, {-240,  49}, {-241,  49}, {-241,  48},
+    {-241,  47}, {-241,  47}, {-241,  46}, {-241,  45}, {-241,  44}, {-241,  44}, {-242,  43}, {-242,  42},
+    {-242,  42}, {-242,  41}, {-242,  40}, {-242,  40}, {-242,  39}, {-242,  38}, {-243,  37}, {-243,  37},
+    {-243,  36}, {-243,  35}, {-243,  35}, {-243,  34}, {-243,  33}, {-243,  32}, {-243,  32}, {-243,  31},
+    {-244,  30}, {-244,  29}, {-244,  29}, {-244,  28}, {-244,  27}, {-244,  27}, {-244,  26}, {-244,  25},
+    {-244,  24}, {-244,  24}, {-244,  23}, {-244,  22}, {-244,  22}, {-245,  21}, {-245,  20}, {-245,  19},
+    {-245,  19}, {-245,  18}, {-245,  17}, {-245,  17}, {-245,  16}, {-245,  15}, {-245,  14}, {-245,  14},
+    {-245,  13}, {-245,  12}, {-245,  12}, {-245,  11}, {-245,  10}, {-245,   9}, {-245,   9}, {-245,   8},
+    {-245,   7}, {-245,   6}, {-245,   6}, {-245,   5}, {-245,   4}, {-245,   4}, {-245,   3}, {-245,   2},
+    {-245,   1}, {-245,   1}, {-245,   0}, {-245,  -1}, {-245,  -1}, {-245,  -2}, {-245,  -3}, {-245,  -4},
+    {-245,  -4}, {-245,  -5}, {-245,  -6}, {-245,  -7}, {-245,  -7}, {-245,  -8}, {-245,  -9}, {-245,  -9},
+    {-245, -10}, {-245, -11}, {-245, -12}, {-245, -12}, {-245, -13}, {-245, -14}, {-245, -14}, {-245, -15},
+    {-245, -16}, {-245, -17}, {-245, -17}, {-245, -18}, {-245, -19}, {-245, -19}, {-245, -20}, {-245, -21},
+    {-245, -22}, {-245, -22}, {-244, -23}, {-244, -24}, {-244, -25}, {-244, -25}, {-244, -26}, {-244, -27},
+    {-244, -27}, {-244, -28}, {-244, -29}, {-244, -30}, {-244, -30}, {-244, -31}, {-244, -32}, {-243, -32},
+    {-243, -33}, {-243, -34}, {-243, -35}, {-243, -35}, {-243, -36}, {-243, -37}, {-243, -37}, {-243, -38},
+    {-242, -39}, {-242, -40}, {-242, -40}, {-242, -41}, {-242, -42}, {-242, -42}, {-242, -43}, {-242, -44},
+    {-242, -45}, {-241, -45}, {-241, -46}, {-241, -47}, {-241, -47}, {-241, -48}, {-241, -49}, {-241, -49},
+    {-240, -50}, {-240, -51}, {-240, -52}, {-240, -52}, {-240, -53}, {-240, -54}, {-239, -54}, {-239, -55},
+    {-239, -56}, {-239, -57}, {-239, -57}, {-239, -58}, {-239, -59}, {-238, -59}, {-238, -60}, {-238, -61},
+    {-238, -61}, {-238, -62}, {-237, -63}, {-237, -64}, {-237, -64}, {-237, -65}, {-237, -66}, {-236, -66},
+    {-236, -67}, {-236, -68}, {-236, -68}, {-236, -69}, {-235, -70}, {-235, -70}, {-235, -71}, {-235, -72},
+    {-235, -73}, {-234, -73}, {-234, -74}, {-234, -75}, {-234, -75}, {-234, -76}, {-233, -77}, {-233, -77},
+    {-233, -78}, {-233, -79}, {-232, -79}, {-232, -80}, {-232, -81}, {-232, -81}, {-231, -82}, {-231, -83},
+    {-231, -83}, {-231, -84}, {-231, -85}, {-230, -86}, {-230, -86}, {-230, -87}, {-230, -88}, {-229, -88},
+    {-229, -89}, {-229, -90}, {-228, -90}, {-228, -91}, {-228, -92}, {-228, -92}, {-227, -93}, {-227, -94},
+    {-227, -94}, {-227, -95}, {-226, -96}, {-226, -96}, {-226, -97}, {-225, -98}, {-225, -98}, {-225, -99},
+    {-225,-100}, {-224,-100}, {-224,-101}, {-224,-102}, {-223,-102}, {-223,-103}, {-223,-104}, {-222,-104},
+    {-222,-105}, {-222,-105}, {-222,-106}, {-221,-107}, {-221,-107}, {-221,-108}, {-220,-109}, {-220,-109},
+    {-220,-110}, {-219,-111}, {-219,-111}, {-219,-112}, {-218,-113}, {-218,-113}, {-218,-114}, {-217,-114},
+    {-217,-115}, {-217,-116}, {-216,-116}, {-216,-117}, {-216,-118}, {-215,-118}, {-215,-119}, {-215,-120},
+    {-214,-120}, {-214,-121}, {-214,-121}, {-213,-122}, {-213,-123}, {-212,-123}, {-212,-124}, {-212,-125},
+    {-211,-125}, {-211,-126}, {-211,-126}, {-210,-127}, {-210,-128}, {-210,-128}, {-209,-129}, {-209,-130},
+    {-208,-130}, {-208,-131}, {-208,-131}, {-207,-132}, {-207,-133}, {-206,-133}, {-206,-134}, {-206,-134},
+    {-205,-135}, {-205,-136}, {-204,-136}, {-204,-137}, {-204,-137}, {-203,-138}, {-203,-139}, {-202,-139},
+    {-202,-140}, {-202,-140}, {-201,-141}, {-201,-142}, {-200,-142}, {-200,-143}, {-200,-143}, {-199,-144},
+    {-199,-144}, {-198,-145}, {-198,-146}, {-197,-146}, {-197,-147}, {-197,-147}, {-196,-148}, {-196,-149},
+    {-195,-149}, {-195,-150}, {-194,-150}, {-194,-151}, {-193,-151}, {-193,-152}, {-193,-153}, {-192,-153},
+    {-192,-154}, {-191,-154}, {-191,-155}, {-190,-155}, {-190,-156}, {-189,-156}, {-189,-157}, {-189,-158},
+    {-188,-158}, {-188,-159}, {-187,-159}, {-187,-160}, {-186,-160}, {-186,-161}, {-185,-161}, {-185,-162},
+    {-184,-163}, {-184,-163}, {-183,-164}, {-183,-164}, {-182,-165}, {-182,-165}, {-181,-166}, {-181,-166},
+    {-180,-167}, {-180,-167}, {-179,-168}, {-179,-168}, {-178,-169}, {-178,-169}, {-177,-170}, {-177,-170},
+    {-176,-171}, {-176,-171}, {-175,-172}, {-175,-173}, {-174,-173}, {-174,-174}, {-173,-174}, {-173,-175},
+    {-172,-175}, {-172,-176}, {-171,-176}, {-171,-177}, {-170,-177}, {-170,-178}, {-169,-178}, {-169,-179},
+    {-168,-179}, {-168,-180}, {-167,-180}, {-167,-181}, {-166,-181}, {-166,-182}, {-165,-182}, {-165,-183},
+    {-164,-183}, {-163,-183}, {-163,-184}, {-162,-184}, {-162,-185}, {-161,-185}, {-161,-186}, {-160,-186},
+    {-160,-187}, {-159,-187}, {-159,-188}, {-158,-188}, {-157,-189}, {-157,-189}, {-156,-190}, {-156,-190},
+    {-155,-190}, {-155,-191}, {-154,-191}, {-153,-192}, {-153,-192}, {-152,-193}, {-152,-193}, {-151,-194},
+    {-151,-194}, {-150,-195}, {-150,-195}, {-149,-195}, {-148,-196}, {-148,-196}, {-147,-197}, {-147,-197},
+    {-146,-198}, {-145,-198}, {-145,-198}, {-144,-199}, {-144,-199}, {-143,-200}, {-143,-200}, {-142,-201},
+    {-141,-201}, {-141,-201}, {-140,-202}, {-140,-202}, {-139,-203}, {-138,-203}, {-138,-203}, {-137,-204},
+    {-137,-204}, {-136,-205}, {-135,-205}, {-135,-205}, {-134,-206}, {-134,-206}, {-133,-207}, {-132,-207},
+    {-132,-207}, {-131,-208}, {-131,-208}, {-130,-208}, {-129,-209}, {-129,-209}, {-128,-210}, {-128,-210},
+    {-127,-210}, {-126,-211}, {-126,-211}, {-125,-211}, {-124,-212}, {-124,-212}, {-123,-213}, {-123,-213},
+    {-122,-213}, {-121,-214}, {-121,-214}, {-120,-214}, {-119,-215}, {-119,-215}, {-118,-215}, {-117,-216},
+    {-117,-216}, {-116,-216}, {-116,-217}, {-115,-217}, {-114,-217}, {-114,-218}, {-113,-218}, {-112,-218},
+    {-112,-219}, {-111,-219}, {-110,-219}, {-110,-220}, {-109,-220}, {-109,-220}, {-108,-221}, {-107,-221},
+    {-107,-221}, {-106,-222}, {-105,-222}, {-105,-222}, {-104,-223}, {-103,-223}, {-103,-223}, {-102,-223},
+    {-101,-224}, {-101,-224}, {-100,-224}, { -99,-225}, { -99,-225}, { -98,-225}, { -97,-226}, { -97,-226},
+    { -96,-226}, { -95,-226}, { -95,-227}, { -94,-227}, { -93,-227}, { -93,-227}, { -92,-228}, { -91,-228},
+    { -91,-228}, { -90,-229}, { -89,-229}, { -89,-229}, { -88,-229}, { -87,-230}, { -87,-230}, { -86,-230},
+    { -85,-230}, { -85,-231}, { -84,-231}, { -83,-231}, { -83,-231}, { -82,-232}, { -81,-232}, { -81,-232},
+    { -80,-232}, { -79,-233}, { -79,-233}, { -78,-233}, { -77,-233}, { -76,-233}, { -76,-234}, { -75,-234},
+    { -74,-234}, { -74,-234}, { -73,-235}, { -72,-235}, { -72,-235}, { -71,-235}, { -70,-235}, { -70,-236},
+    { -69,-236}, { -68,-236}, { -67,-236}, { -67,-236}, { -66,-237}, { -65,-237}, { -65,-237}, { -64,-237},
+    { -63,-237}, { -63,-237}, { -62,-238}, { -61,-238}, { -61,-238}, { -60,-238}, { -59,-238}, { -58,-239},
+    { -58,-239}, { -57,-239}, { -56,-239}, { -56,-239}, { -55,-239}, { -54,-240}, { -53,-240}, { -53,-240},
+    { -52,-240}, { -51,-240}, { -51,-240}, { -50,-240}, { -49,-241}, { -49,-241}, { -48,-241}, { -47,-241},
+    { -46,-241}, { -46,-241}, { -45,-241}, { -44,-242}, { -44,-242}, { -43,-242}, { -42,-242}, { -41,-242},
+    { -41,-242}, { -40,-242}, { -39,-242}, { -39,-243}, { -38,-243}, { -37,-243}, { -36,-243}, { -36,-243},
+    { -35,-243}, { -34,-243}, { -34,-243}, { -33,-243}, { -32,-243}, { -31,-244}, { -31,-244}, { -30,-244},
+    { -29,-244}, { -29,-244}, { -28,-244}, { -27,-244}, { -26,-244}, { -26,-244}, { -25,-244}, { -24,-244},
+    { -24,-244}, { -23,-244}, { -22,-245}, { -21,-245}, { -21,-245}, { -20,-245}, { -19,-245}, { -19,-245},
+    { -18,-245}, { -17,-245}, { -16,-245}, { -16,-245}, { -15,-245}, { -14,-245}, { -13,-245}, { -13,-245},
+    { -12,-245}, { -11,-245}, { -11,-245}, { -10,-245}, {  -9,-245}, {  -8,-245}, {  -8,-245}, {  -7,-245},
+    {  -6,-245}, {  -6,-245}, {  -5,-245}, {  -4,-245}, {  -3,-245}, {  -3,-245}, {  -2,-245}, {  -1,-245},
+    {   0,-245}, {   0,-245}, {   1,-245}, {   2,-245}, {   2,-245}, {   3,-245}, {   4,-245}, {   5,-245},
+    {   5,-245}, {   6,-245}, {   7,-245}, {   7,-245}, {   8,-245}, {   9,-245}, {  10,-245}, {  10,-245},
+    {  11,-245}, {  12,-245}, {  12,-245}, {  13,-245}, {  14,-245}, {  15,-245}, {  15,-245}, {  16,-245},
+    {  17,-245}, {  18,-245}, {  18,-245}, {  19,-245}, {  20,-245}, {  20,-245}, {  21,-245}, {  22,-244},
+    {  23,-244}, {  23,-244}, {  24,-244}, {  25,-244}, {  25,-244}, {  26,-244}, {  27,-244}, {  28,-244},
+    {  28,-244}, {  29,-244}, {  30,-244}, {  30,-244}, {  31,-243}, {  32,-243}, {  33,-243}, {  33,-243},
+    {  34,-243}, {  35,-243}, {  35,-243}, {  36,-243}, {  37,-243}, {  38,-243}, {  38,-242}, {  39,-242},
+    {  40,-242}, {  40,-242}, {  41,-242}, {  42,-242}, {  43,-242}, {  43,-242}, {  44,-241}, {  45,-241},
+    {  45,-241}, {  46,-241}, {  47,-241}, {  48,-241}, {  48,-241}, {  49,-240}, {  50,-240}, {  50,-240},
+    {  51,-240}, {  52,-240}, {  52,-240}, {  53,-240}, {  54,-239}, {  55,-239}, {  55,-239}, {  56,-239},
+    {  57,-239}, {  57,-239}, {  58,-238}, {  59,-238}, {  59,-238}, {  60,-238}, {  61,-238}, {  62,-238},
+    {  62,-237}, {  63,-237}, {  64,-237}, {  64,-237}, {  65,-237}, {  66,-236}, {  66,-236}, {  67,-236},
+    {  68,-236}, {  69,-236}, {  69,-235}, {  70,-235}, {  71,-235}, {  71,-235}, {  72,-235}, {  73,-234},
+    {  73,-234}, {  74,-234}, {  75,-234}, {  75,-233}, {  76,-233}, {  77,-233}, {  77,-233}, {  78,-233},
+    {  79,-232}, {  80,-232}, {  80,-232}, {  81,-232}, {  82,-231}, {  82,-231}, {  83,-231}, {  84,-231},
+    {  84,-230}, {  85,-230}, {  86,-230}, {  86,-230}, {  87,-229}, {  88,-229}, {  88,-229}, {  89,-229},
+    {  90,-228}, {  90,-228}, {  91,-228}, {  92,-227}, {  92,-227}, {  93,-227}, {  94,-227}, {  94,-226},
+    {  95,-226}, {  96,-226}, {  96,-226}, {  97,-225}, {  98,-225}, {  98,-225}, {  99,-224}, { 100,-224},
+    { 100,-224}, { 101,-223}, { 102,-223}, { 102,-223}, { 103,-223}, { 104,-222}, { 104,-222}, { 105,-222},
+    { 106,-221}, { 106,-221}, { 107,-221}, { 107,-220}, { 108,-220}, { 109,-220}, { 109,-219}, { 110,-219},
+    { 111,-219}, { 111,-218}, { 112,-218}, { 113,-218}, { 113,-217}, { 114,-217}, { 115,-217}, { 115,-216},
+    { 116,-216}, { 116,-216}, { 117,-215}, { 118,-215}, { 118,-215}, { 119,-214}, { 120,-214}, { 120,-214},
+    { 121,-213}, { 122,-213}, { 122,-213}, { 123,-212}, { 123,-212}, { 124,-212}, { 125,-211}, { 125,-211},
+    { 126,-210}, { 126,-210}, { 127,-210}, { 128,-209}, { 128,-209}, { 129,-209}, { 130,-208}, { 130,-208},
+    { 131,-207}, { 131,-207}, { 132,-207}, { 133,-206}, { 133,-206}, { 134,-205}, { 134,-205}, { 135,-205},
+    { 136,-204}, { 136,-204}, { 137,-203}, { 137,-203}, { 138,-203}, { 139,-202}, { 139,-202}, { 140,-201},
+    { 140,-201}, { 141,-201}, { 142,-200}, { 142,-200}, { 143,-199}, { 143,-199}, { 144,-198}, { 144,-198},
+    { 145,-198}, { 146,-197}, { 146,-197}, { 147,-196}, { 147,-196}, { 148,-195}, { 149,-195}, { 149,-195},
+    { 150,-194}, { 150,-194}, { 151,-193}, { 151,-193}, { 152,-192}, { 152,-192}, { 153,-191}, { 154,-191},
+    { 154,-190}, { 155,-190}, { 155,-190}, { 156,-189}, { 156,-189}, { 157,-188}, { 158,-188}, { 158,-187},
+    { 159,-187}, { 159,-186}, { 160,-186}, { 160,-185}, { 161,-185}, { 161,-184}, { 162,-184}, { 162,-183},
+    { 163,-183}, { 163,-183}, { 164,-182}, { 165,-182}, { 165,-181}, { 166,-181}, { 166,-180}, { 167,-180},
+    { 167,-179}, { 168,-179}, { 168,-178}, { 169,-178}, { 169,-177}, { 170,-177}, { 170,-176}, { 171,-176},
+    { 171,-175}, { 172,-175}, { 172,-174}, { 173,-174}, { 173,-173}, { 174,-173}, { 174,-172}, { 175,-172},
+    { 175,-171}, { 176,-170}, { 176,-170}, { 177,-169}, { 177,-169}, { 178,-168}, { 178,-168}, { 179,-167},
+    { 179,-167}, { 180,-166}, { 180,-166}, { 181,-165}, { 181,-165}, { 182,-164}, { 182,-164}, { 183,-163},
+    { 183,-163}, { 184,-162}, { 184,-161}, { 185,-161}, { 185,-160}, { 186,-160}, { 186,-159}, { 187,-159},
+    { 187,-158}, { 187,-158}, { 188,-157}, { 188,-156}, { 189,-156}, { 189,-155}, { 190,-155}, { 190,-154},
+    { 191,-154}, { 191,-153}, { 192,-153}, { 192,-152}, { 192,-151}, { 193,-151}, { 193,-150}, { 194,-150},
+    { 194,-149}, { 195,-149}, { 195,-148}, { 196,-147}, { 196,-147}, { 196,-146}, { 197,-146}, { 197,-145},
+    { 198,-145}, { 198,-144}, { 199,-143}, { 199,-143}, { 199,-142}, { 200,-142}, { 200,-141}, { 201,-140},
+    { 201,-140}, { 201,-139}, { 202,-139}, { 202,-138}, { 203,-137}, { 203,-137}, { 203,-136}, { 204,-136},
+    { 204,-135}, { 205,-134}, { 205,-134}, { 205,-133}, { 206,-133}, { 206,-132}, { 207,-131}, { 207,-131},
+    { 207,-130}, { 208,-130}, { 208,-129}, { 209,-128}, { 209,-128}, { 209,-127}, { 210,-126}, { 210,-126},
+    { 210,-125}, { 211,-125}, { 211,-124}, { 211,-123}, { 212,-123}, { 212,-122}, { 213,-121}, { 213,-121},
+    { 213,-120}, { 214,-120}, { 214,-119}, { 214,-118}, { 215,-118}, { 215,-117}, { 215,-116}, { 216,-116},
+    { 216,-115}, { 216,-115}, { 217,-114}, { 217,-113}, { 217,-113}, { 218,-112}, { 218,-111}, { 218,-111},
+    { 219,-110}, { 219,-109}, { 219,-109}, { 220,-108}, { 220,-107}, { 220,-107}, { 221,-106}, { 221,-105},
+    { 221,-105}, { 221,-104}, { 222,-104}, { 222,-103}, { 222,-102}, { 223,-102}, { 223,-101}, { 223,-100},
+    { 224,-100}, { 224, -99}, { 224, -98}, { 224, -98}, { 225, -97}, { 225, -96}, { 225, -96}, { 226, -95},
+    { 226, -94}, { 226, -94}, { 226, -93}, { 227, -92}, { 227, -92}, { 227, -91}, { 227, -90}, { 228, -90},
+    { 228, -89}, { 228, -88}, { 229, -88}, { 229, -87}, { 229, -86}, { 229, -86}, { 230, -85}, { 230, -84},
+    { 230, -84}, { 230, -83}, { 230, -82}, { 231, -81}, { 231, -81}, { 231, -80}, { 231, -79}, { 232, -79},
+    { 232, -78}, { 232, -77}, { 232, -77}, { 233, -76}, { 233, -75}, { 233, -75}, { 233, -74}, { 233, -73},
+    { 234, -73}, { 234, -72}, { 234, -71}, { 234, -70}, { 234, -70}, { 235, -69}, { 235, -68}, { 235, -68},
+    { 235, -67}, { 235, -66}, { 236, -66}, { 236, -65}, { 236, -64}, { 236, -64}, { 236, -63}, { 237, -62},
+    { 237, -61}, { 237, -61}, { 237, -60}, { 237, -59}, { 237, -59}, { 238, -58}, { 238, -57}, { 238, -57},
+    { 238, -56}, { 238, -55}, { 238, -54}, { 239, -54}, { 239, -53}, { 239, -52}, { 239, -52}, { 239, -51},
+    { 239, -50}, { 240, -49}, { 240, -49}, { 240, -48}, { 240, -47}, { 240, -47}, { 240, -46}, { 240, -45},
+    { 241, -45}, { 241, -44}, { 241, -43}, { 241, -42}, { 241, -42}, { 241, -41}, { 241, -40}, { 241, -40},
+    { 241, -39}, { 242, -38}, { 242, -37}, { 242, -37}, { 242, -36}, { 242, -35}, { 242, -35}, { 242, -34},
+    { 242, -33}, { 242, -32}, { 243, -32}, { 243, -31}, { 243, -30}, { 243, -30}, { 243, -29}, { 243, -28},
+    { 243, -27}, { 243, -27}, { 243, -26}, { 243, -25}, { 243, -25}, { 243, -24}, { 243, -23}, { 244, -22},
+    { 244, -22}, { 244, -21}, { 244, -20}, { 244, -19}, { 244, -19}, { 244, -18}, { 244, -17}, { 244, -17},
+    { 244, -16}, { 244, -15}, { 244, -14}, { 244, -14}, { 244, -13}, { 244, -12}, { 244, -12}, { 244, -11},
+    { 244, -10}, { 244,  -9}, { 244,  -9}, { 244,  -8}, { 244,  -7}, { 244,  -7}, { 244,  -6}, { 244,  -5},
+    { 244,  -4}, { 244,  -4}, { 244,  -3}, { 244,  -2}, { 244,  -1}, { 244,  -1}, { 244,   0}, { 244,   1},
+    { 244,   1}, { 244,   2}, { 244,   3}, { 244,   4}, { 244,   4}, { 244,   5}, { 244,   6}, { 244,   6},
+    { 244,   7}, { 244,   8}, { 244,   9}, { 244,   9}, { 244,  10}, { 244,  11}, { 244,  12}, { 244,  12},
+    { 244,  13}, { 244,  14}, { 244,  14}, { 244,  15}, { 244,  16}, { 244,  17}, { 244,  17}, { 244,  18},
+    { 244,  19}, { 244,  19}, { 244,  20}, { 244,  21}, { 243,  22}, { 243,  22}, { 243,  23}, { 243,  24},
+    { 243,  24}, { 243,  25}, { 243,  26}, { 243,  27}, { 243,  27}, { 243,  28}, { 243,  29}, { 243,  29},
+    { 243,  30}, { 242,  31}, { 242,  32}, { 242,  32}, { 242,  33}, { 242,  34}, { 242,  34}, { 242,  35},
+    { 242,  36}, { 242,  37}, { 242,  37}, { 241,  38}, { 241,  39}, { 241,  39}, { 241,  40}, { 241,  41},
+    { 241,  42}, { 241,  42}, { 241,  43}, { 240,  44}, { 240,  44}, { 240,  45}, { 240,  46}, { 240,  47},
+    { 240,  47}, { 240,  48}, { 240,  49}, { 239,  49}, { 239,  50}, { 239,  51}, { 239,  52}, { 239,  52},
+    { 239,  53}, { 238,  54}, { 238,  54}, { 238,  55}, { 238,  56}, { 238,  56}, { 238,  57}, { 237,  58},
+    { 237,  59}, { 237,  59}, { 237,  60}, { 237,  61}, { 237,  61}, { 236,  62}, { 236,  63}, { 236,  63},
+    { 236,  64}, { 236,  65}, { 235,  66}, { 235,  66}, { 235,  67}, { 235,  68}, { 235,  68}, { 234,  69},
+    { 234,  70}, { 234,  70}, { 234,  71}, { 234,  72}, { 233,  72}, { 233,  73}, { 233,  74}, { 233,  75},
+    { 233,  75}, { 232,  76}, { 232,  77}, { 232,  77}, { 232,  78}, { 231,  79}, { 231,  79}, { 231,  80},
+    { 231,  81}, { 230,  81}, { 230,  82}, { 230,  83}, { 230,  83}, { 229,  84}, { 229,  85}, { 229,  85},
+    { 229,  86}, { 228,  87}, { 228,  87}, { 228,  88}, { 228,  89}, { 227,  89}, { 227,  90}, { 227,  91},
+    { 227,  91}, { 226,  92}, { 226,  93}, { 226,  93}, { 225,  94}, { 225,  95}, { 225,  95}, { 225,  96},
+    { 224,  97}, { 224,  97}, { 224,  98}, { 223,  99}, { 223,  99}, { 223, 100}, { 223, 101}, { 222, 101},
+    { 222, 102}, { 222, 103}, { 221, 103}, { 221, 104}, { 221, 105}, { 220, 105}, { 220, 106}, { 220, 107},
+    { 220, 107}, { 219, 108}, { 219, 109}, { 219, 109}, { 218, 110}, { 218, 110}, { 218, 111}, { 217, 112},
+    { 217, 112}, { 217, 113}, { 216, 114}, { 216, 114}, { 216, 115}, { 215, 116}, { 215, 116}, { 215, 117},
+    { 214, 118}, { 214, 118}, { 213, 119}, { 213, 119}, { 213, 120}, { 212, 121}, { 212, 121}, { 212, 122},
+    { 211, 123}, { 211, 123}, { 211, 124}, { 210, 124}, { 210, 125}, { 210, 126}, { 209, 126}, { 209, 127},
+    { 208, 128}, { 208, 128}, { 208, 129}, { 207, 129}, { 207, 130}, { 206, 131}, { 206, 131}, { 206, 132},
+    { 205, 132}, { 205, 133}, { 205, 134}, { 204, 134}, { 204, 135}, { 203, 135}, { 203, 136}, { 203, 137},
+    { 202, 137}, { 202, 138}, { 201, 138}, { 201, 139}, { 201, 140}, { 200, 140}, { 200, 141}, { 199, 141},
+    { 199, 142}, { 198, 143}, { 198, 143}, { 198, 144}, { 197, 144}, { 197, 145}, { 196, 145}, { 196, 146},
+    { 195, 147}, { 195, 147}, { 195, 148}, { 194, 148}, { 194, 149}, { 193, 149}, { 193, 150}, { 192, 151},
+    { 192, 151}, { 191, 152}, { 191, 152}, { 191, 153}, { 190, 153}, { 190, 154}, { 189, 155}, { 189, 155},
+    { 188, 156}, { 188, 156}, { 187, 157}, { 187, 157}, { 186, 158}, { 186, 158}, { 185, 159}, { 185, 160},
+    { 185, 160}, { 184, 161}, { 184, 161}, { 183, 162}, { 183, 162}, { 182, 163}, { 182, 163}, { 181, 164},
+    { 181, 164}, { 180, 165}, { 180, 165}, { 179, 166}, { 179, 167}, { 178, 167}, { 178, 168}, { 177, 168},
+    { 177, 169}, { 176, 169}, { 176, 170}, { 175, 170}, { 175, 171}, { 174, 171}, { 174, 172}, { 173, 172},
+    { 173, 173},
+};
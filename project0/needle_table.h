@@ -0,0 +1,18 @@
+// Generated by host/gen_gauge.c (make -C project0/host tables) from gauge_layout.h, do not edit
+#ifndef NEEDLE_TABLE_H_
+#define NEEDLE_TABLE_H_
+
+#include <stdint.h>
+
+#define NEEDLE_TABLE_STEP 25       // Speed step per entry, in 1/100 km/h
+#define NEEDLE_TABLE_SIZE 1601     // Entries for 0..MAX_SPEED
+
+// Needle end point relative to the gauge center
+typedef struct {
+    int16_t dx;
+    int16_t dy;
+} needle_point_t;
+
+extern const needle_point_t needle_table[NEEDLE_TABLE_SIZE];
+
+#endif
@@ -7,6 +7,7 @@
 #include "driverlib/gpio.h"
 #include "driverlib/timer.h"
 #include "driverlib/interrupt.h"
+#include "driverlib/uart.h"
 #include "utils/uartstdio.h"
 #include "driverlib/pin_map.h"
 #include "inc/hw_ints.h"
@@ -14,10 +15,21 @@
 // Sub-modules
 #include "interrupt.h"
 #include "display.h"
+#include "frame_timing.h"
+#include "cycles.h"
+
+#ifdef FIXMATH_BENCH
+void fixmath_bench(void);
+#endif
+#ifdef DISPLAY_BENCH
+void display_bus_bench(void);
+#endif
+#ifdef EDGE_BENCH
+void edge_bench(uint32_t sysclk);
+#endif
 
 // Macros
-#define WINDOW_MS 100
-#define DISPLAY_WINDOW_MS 50
+#define RENDER_SLICE_US 500     // longest stretch the renderer runs before calc_flag is checked again
 #define WARNING_LIMIT 30  // Seconds before warning light show up 
 #define MOTOR_S1 GPIO_PIN_0
 #define MOTOR_S2 GPIO_PIN_1
@@ -61,8 +73,8 @@ void init_timer(void){
     // Wait for Timer 2 to be ready
     while (!SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER2)){};
 
-    window_timer_period = sysclk / (1000 / WINDOW_MS); // 100ms
-    display_timer_period = sysclk / (1000 / DISPLAY_WINDOW_MS); // 50ms
+    window_timer_period = sysclk / (1000 / WINDOW_MS); // 100ms, see interrupt.h
+    display_timer_period = sysclk / (1000 / DISPLAY_WINDOW_MS); // 20ms
     warning_timer_period = sysclk / (1000 / 10e3); // 10 seconds into ms
 }
 
@@ -82,49 +94,119 @@ void init_uart(void){
     UARTStdioConfig(0, 115200, sysclk);
 }
 
+// Debug commands over UART: 'f' prints frame statistics, 'r' resets them
+void poll_uart_commands(void){
+    while (UARTCharsAvail(UART0_BASE)) {
+        switch (UARTCharGetNonBlocking(UART0_BASE)) {
+        case 'f': frame_stats_print(); break;
+        case 'r': frame_stats_reset(); break;
+        default: break;
+        }
+    }
+}
+
+// Boot timeline over UART, cycles since cycles_init() right after the clock setup
+static void print_boot_timeline(uint32_t t_display, uint32_t t_speed, uint32_t t_frame){
+    uint32_t per_us = sysclk / 1000000;
+    UARTprintf("Boot: display ready %u us, first speed %u us, first frame %u us\n",
+               t_display / per_us, t_speed / per_us, t_frame / per_us);
+}
+
 int main(void)
 {
+    uint32_t pending_ms = 0;        // display time not yet handed to the compositor
+    bool display_ready = false;     // controller configured and first frame drawn
+    bool frame_due = false;         // a display tick is waiting for the current frame to finish
+    bool frame_busy = false;        // compose pass started, more slices to go
+    uint32_t render_slice;          // RENDER_SLICE_US in cycles
+    uint32_t t_display = 0, t_speed = 0, t_frame = 0;   // boot timeline, cycles
+    bool timeline_printed = false;
+
     // Setup phase
     init_clock();                   // Initialise system clock
+    cycles_init();                  // Boot timeline starts here
     init_uart();                    // Setup UART connection to PC for Debugging
+#ifdef FIXMATH_BENCH
+    fixmath_bench();                // double vs. Q16.16 cycles per frame, printed over UART
+#endif
     init_timer();                   // Setup timer
+    frame_timing_init(display_timer_period);    // Frame budget: one display period
+    render_slice = sysclk / 1000000 * RENDER_SLICE_US;
+
+    init_ports_display();           // Init Port L for Display Control and Port M for Display Data
+#ifdef DISPLAY_BENCH
+    display_init_start();           // blocking bring-up, the bench needs the panel now
+    while (!display_init_poll());
+    display_bus_bench();            // fill throughput in Mpixel/s, printed over UART
+#endif
+    display_init_start();           // display bring-up continues in the main loop, waits on Timer3
 
     IntMasterDisable();              // Crucial: NVIC for whole board
     init_motor_ports_interrupts();  // Setup ports for motors and enable their interrupts
     init_timer_interrupt();         // Enable interrupts for timer0 - window
     display_timer_interrupt();      // Enable interrupts for timer1 - display
     IntMasterEnable();              // Allow interrupts for CPU 
-
-    init_ports_display();           // Init Port L for Display Control and Port M for Display Data
-	configure_display_controller_large();  // display init and configuration
+#ifdef EDGE_BENCH
+    edge_bench(sysclk);             // cycles per S1/S2 edge and max edge rate, printed over UART
+#endif
 
     // Check for UART functionality, startup message
     UARTprintf("KMZ60 Measurement started. \n");
-    
-    // Clear screen with black background
-    reset_background();
-    
-    // Bresenham arc
-    draw_bresenham_ticks();
-    draw_arc(); 
 
     // Loop Forever
     while(1)
     {   
-        // Speed variable update every 100ms
+        // Speed variable update every 10ms (100ms average), widgets only get the new values
         if(calc_flag){          
+            frame_calc_begin();
             calc_speed_dir(); 
-            draw_odometer(distance_total);
-            draw_direction(directionForwards);
+            display_set_speed(speed);
+            display_set_distance(distance_total / 10000);   // mm -> 1/100 km
+            display_set_direction(directionForwards);
+            if (!t_speed) t_speed = cycles_now();
+        }
+        if (!timeline_printed && display_ready && t_speed) {
+            print_boot_timeline(t_display, t_speed, t_frame);
+            timeline_printed = true;
+        }
+
+        // Display bring-up: next step once its wait is over, then the first full frame,
+        // in slices as every other frame
+        if (!display_ready) {
+            if (!frame_busy && display_init_poll()) {
+                t_display = cycles_now();
+                display_ui_init();      // register the widgets
+                display_compose_begin(0);   // first pass clears the screen and draws every widget
+                frame_busy = true;
+            }
+            update_display = false;     // nothing to refresh yet
         }
         
-        // Display refresh every 50ms (20 Hz)
+        // Compositor pass every 20ms (50 Hz). It is drawn in slices of RENDER_SLICE_US, so
+        // calc_flag is served between slices instead of waiting for the whole frame.
         if(update_display){
-            /*Draw needle with bresenham algo*/
-            draw_bresenham(speed);
-            draw_bresenham_ticks(); // draw the numbers!
             update_display = false;
+            pending_ms += DISPLAY_WINDOW_MS;    // skipped ticks still count for the widget periods
+            frame_due = true;
         }
-        
+        if (frame_due && !frame_busy) {
+            frame_due = false;
+            if (frame_begin()) {        // skipped after a frame overran its budget
+                display_set_warning(warning_flag);
+                display_compose_begin(pending_ms);
+                pending_ms = 0;
+                frame_busy = true;
+            }
+        }
+        if (frame_busy && display_compose_step(render_slice)) {
+            if (display_ready) frame_end();     // widgets drawn and shadow tiles flushed
+            else {
+                t_frame = cycles_now();
+                display_ready = true;
+            }
+            frame_busy = false;
+        }
+
+        poll_uart_commands();
     }
 }
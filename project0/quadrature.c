@@ -0,0 +1,173 @@
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "quadrature.h"
+
+#ifdef HOST_BUILD
+#include "qei_model.h"      // same register names as inc/hw_qei.h
+#define QEI_READ(reg) qei_model_read(reg)
+#define QEI_WRITE(reg, value) qei_model_write(reg, value)
+#else
+#include "inc/hw_types.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_qei.h"
+#define QEI_READ(reg) HWREG(QEI0_BASE + (reg))
+#define QEI_WRITE(reg, value) (HWREG(QEI0_BASE + (reg)) = (value))
+#endif
+
+// Speed from the time between steps below COUNT_MODE_STEPS per window, from the step
+// count above (back to period mode below COUNT_MODE_STEPS - COUNT_MODE_HYST)
+#ifndef COUNT_MODE_STEPS
+#define COUNT_MODE_STEPS 80     // 20 S1 periods
+#endif
+#define COUNT_MODE_HYST 16
+
+#define QUAD_ILLEGAL 2          // both signals changed at once, direction unknown
+
+// Step per transition, index (previous state << 2) | state with state = S1 | S2 << 1.
+// Forwards S1 leads S2: 00 -> 10 -> 11 -> 01 -> 00 (S1 S2).
+static const int8_t quad_table[16] = {
+    0, +1, -1, QUAD_ILLEGAL,    // from 00
+    -1, 0, QUAD_ILLEGAL, +1,    // from S1
+    +1, QUAD_ILLEGAL, 0, -1,    // from S2
+    QUAD_ILLEGAL, -1, +1, 0     // from both
+};
+
+/********************************************************************************/
+// Global Variables
+/********************************************************************************/
+// GPIO backend, written by the edge ISR
+static volatile uint32_t prev_state = 0;
+static volatile bool forwards = true;
+static volatile int32_t position = 0;       // signed steps since start
+static volatile uint32_t illegal = 0;       // illegal transitions in this window
+static volatile uint32_t steps = 0;         // legal steps in this window
+static volatile uint32_t step_last = 0;     // cycles of the last step
+static volatile bool step_valid = false;    // step_last starts a period
+static volatile uint32_t period_sum = 0;    // step periods that ended in this window, cycles
+static volatile uint32_t periods = 0;
+
+// QEI backend
+static uint32_t qei_last_pos = 0;           // position at the last window
+
+// Speed, GPIO backend
+static bool count_mode = false;
+static fix16_t edges_f = 0;                 // S1 periods per window as last used for the speed
+
+/********************************************************************************/
+// GPIO backend
+/********************************************************************************/
+void quad_gpio_init(uint32_t state){
+    prev_state = state;
+}
+
+void quad_gpio_edge(uint32_t state, uint32_t now){
+    int32_t step = quad_table[(prev_state << 2) | state];
+
+    prev_state = state;
+    if (step == 0) return;          // bounce, nothing changed
+    if (step == QUAD_ILLEGAL) {     // missed an edge: no direction, no period across it
+        illegal++;
+        step_valid = false;
+        return;
+    }
+    position += step;
+    forwards = step > 0;
+    steps++;
+    if (step_valid) {
+        period_sum += now - step_last;
+        periods++;
+    }
+    step_last = now;
+    step_valid = true;
+}
+
+void quad_gpio_window(quad_window_t *w, uint32_t now, uint32_t timeout_cycles){
+    w->steps = steps;
+    w->forwards = forwards;
+    w->position = position;
+    w->illegal = illegal;
+    w->timed = true;
+    w->period_sum = period_sum;
+    w->periods = periods;
+    w->since = step_valid ? now - step_last : QUAD_NO_EDGE;
+
+    // standstill: forget the last step before the cycle counter wraps around it
+    if (w->since >= timeout_cycles) step_valid = false;
+
+    steps = 0;
+    illegal = 0;
+    period_sum = 0;
+    periods = 0;
+}
+
+/********************************************************************************/
+// Sliding window
+/********************************************************************************/
+void quad_window_slide(quad_window_t *sum, const quad_window_t *in, const quad_window_t *out){
+    sum->steps += in->steps - out->steps;
+    sum->illegal += in->illegal - out->illegal;
+    sum->period_sum += in->period_sum - out->period_sum;
+    sum->periods += in->periods - out->periods;
+    sum->forwards = in->forwards;
+    sum->position = in->position;
+    sum->timed = in->timed;
+    sum->since = in->since;
+}
+
+/********************************************************************************/
+// QEI backend
+/********************************************************************************/
+void quad_qei_init(void){
+    QEI_WRITE(QEI_O_CTL, 0);
+    QEI_WRITE(QEI_O_MAXPOS, 0xFFFFFFFF);    // free running, wraps like the signed position
+    QEI_WRITE(QEI_O_POS, 0);
+    QEI_WRITE(QEI_O_ISC, QEI_INTERROR);
+    // quadrature signals, PhA and PhB edges (CAPMODE): four counts per S1 period
+    QEI_WRITE(QEI_O_CTL, QEI_CTL_ENABLE | QEI_CTL_CAPMODE);
+    qei_last_pos = 0;
+}
+
+void quad_qei_window(quad_window_t *w){
+    uint32_t pos = QEI_READ(QEI_O_POS);
+    int32_t delta = (int32_t)(pos - qei_last_pos);
+
+    qei_last_pos = pos;
+    w->steps = delta < 0 ? -delta : delta;
+    w->forwards = !(QEI_READ(QEI_O_STAT) & QEI_STAT_DIRECTION);
+    w->position = (int32_t)pos;
+    w->illegal = (QEI_READ(QEI_O_RIS) & QEI_INTERROR) ? 1 : 0;  // flag only, at least one
+    QEI_WRITE(QEI_O_ISC, QEI_INTERROR);
+    w->timed = false;       // no edge timestamps, the speed is always counted
+    w->period_sum = 0;
+    w->periods = 0;
+    w->since = QUAD_NO_EDGE;
+}
+
+/********************************************************************************/
+// Speed input
+/********************************************************************************/
+fix16_t quad_edges(const quad_window_t *w, uint32_t window_cycles, uint32_t timeout_cycles){
+    if (!w->timed) return (fix16_t)(w->steps << 14);    // QEI: counted only, steps / 4
+
+    if (count_mode ? w->steps >= COUNT_MODE_STEPS - COUNT_MODE_HYST : w->steps >= COUNT_MODE_STEPS) {
+        count_mode = true;
+        edges_f = (fix16_t)(w->steps << 14);
+        return edges_f;
+    }
+    count_mode = false;
+
+    if (w->since >= timeout_cycles) {   // standstill
+        edges_f = 0;
+        return 0;
+    }
+    if (w->periods) {
+        edges_f = ((uint64_t)window_cycles * w->periods << 14) / w->period_sum;
+    }
+    // slowing down: the next step is overdue, the speed is at most one step in w->since
+    if (w->since) {
+        uint64_t bound = ((uint64_t)window_cycles << 14) / w->since;
+        if (bound < (uint64_t)edges_f) edges_f = (fix16_t)bound;
+    }
+    return edges_f;
+}
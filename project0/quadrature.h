@@ -0,0 +1,58 @@
+#ifndef QUADRATURE_H_
+#define QUADRATURE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fixmath.h"
+
+// Quadrature decoding of the motor signals S1/S2 with two backends, same outputs:
+// quadrature steps (every S1 and S2 edge, four per S1 period), direction, signed
+// position and illegal transitions per measurement window.
+//   USE_QEI 0: Port P GPIO interrupt on every S1/S2 edge, decoded by a transition table
+//   USE_QEI 1: QEI0 position counter and direction bit, no interrupt per edge.
+//              PhA0/PhB0 are PL1/PL2 on the TM4C1294NCPDT, which carry the SSD1963
+//              control lines on this board: S1/S2 and the display control have to be
+//              rewired first (BUS_CTRL_PINS in display_bus.h), interrupt.c stops with
+//              #error until then. The host build runs both against host/qei_model.c.
+#ifndef USE_QEI
+#define USE_QEI 0
+#endif
+
+// S1/S2 levels as one state, the Port P bits of the GPIO backend
+#define QUAD_S1 0x01
+#define QUAD_S2 0x02
+
+#define QUAD_NO_EDGE 0xFFFFFFFF     // since: no step to measure from
+
+typedef struct {
+    uint32_t steps;         // legal quadrature steps in the window, either direction
+    bool forwards;
+    int32_t position;       // signed step count since start, at the window end
+    uint32_t illegal;       // transitions that skipped a state (missed edge) in the window
+    bool timed;             // period fields below valid, GPIO backend only
+    uint32_t period_sum;    // cycles between the steps that ended in the window
+    uint32_t periods;
+    uint32_t since;         // cycles from the last step to the window end
+} quad_window_t;
+
+// GPIO backend: S1/S2 state (QUAD_S1 | QUAD_S2) at start and after an edge, from the Port P ISRs
+void quad_gpio_init(uint32_t state);
+void quad_gpio_edge(uint32_t state, uint32_t now);
+// Take the window and start the next one, with the edge interrupt masked.
+// After timeout_cycles without a step the next step starts a new period.
+void quad_gpio_window(quad_window_t *w, uint32_t now, uint32_t timeout_cycles);
+
+// Sliding window over sub-windows: sum += in - out, where out is the sub-window that
+// drops out (zero while the ring fills). Direction, position and since come from in.
+void quad_window_slide(quad_window_t *sum, const quad_window_t *in, const quad_window_t *out);
+
+// QEI backend
+void quad_qei_init(void);       // QEI0 clocked and PhA0/PhB0 muxed by the caller
+void quad_qei_window(quad_window_t *w);
+
+// S1 periods per window (Q16.16) for the speed: counted steps / 4 at high rates, from
+// the mean step period below, 0 after timeout_cycles without a step
+fix16_t quad_edges(const quad_window_t *w, uint32_t window_cycles, uint32_t timeout_cycles);
+
+#endif
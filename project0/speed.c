@@ -0,0 +1,26 @@
+#include <stdint.h>
+
+#include "speed.h"
+#include "interrupt.h"      // WINDOW_MS, SUB_WINDOW_MS
+
+// Macros
+//#define CIRCUMFERENCE 0.444f // Circumference of motor wheel on the board, adjust according to max speed!
+#define CIRCUMFERENCE 0.6f
+#define SPEED_PER_EDGE FIX16_CONST((1000.0 / WINDOW_MS) * 30.0 * CIRCUMFERENCE * 0.06)  // km/h per counted edge
+#define MM_PER_KMH FIX16_CONST(1000000.0 / 3600.0 * (SUB_WINDOW_MS / 1000.0))   // mm per sub-window at 1 km/h
+
+fix16_t speed_kmh(fix16_t edges){
+    return fix16_mul(edges, SPEED_PER_EDGE);    // km/h, taking average within 100ms
+}
+
+uint32_t speed_rpm(fix16_t edges){
+    return fix16_mul_int(edges, (1000 / WINDOW_MS) * (60 / 2));
+}
+
+uint32_t speed_distance_mm(fix16_t speed_f, uint32_t subs, fix16_t *rest){
+    fix16_t delta_f = fix16_mul(speed_f, MM_PER_KMH * subs) + *rest;  // mm
+    uint32_t delta = fix16_to_int(delta_f);
+
+    *rest = delta_f - fix16_from_int(delta);
+    return delta;
+}
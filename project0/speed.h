@@ -0,0 +1,16 @@
+#ifndef SPEED_H_
+#define SPEED_H_
+
+#include <stdint.h>
+
+#include "fixmath.h"
+
+// Speed and distance arithmetic of calc_speed_dir(), without hardware access so
+// fixmath_bench.c times the same code on the host and on the board.
+
+fix16_t speed_kmh(fix16_t edges);       // km/h from S1 periods per window (quad_edges())
+uint32_t speed_rpm(fix16_t edges);      // revolutions per minute from S1 periods per window
+// mm travelled at speed_f km/h over subs sub-windows, the fraction below 1 mm carries over in *rest
+uint32_t speed_distance_mm(fix16_t speed_f, uint32_t subs, fix16_t *rest);
+
+#endif
@@ -25,6 +25,7 @@
 #include <stdint.h>
 #include "inc/hw_nvic.h"
 #include "inc/hw_types.h"
+#include "quadrature.h"     // USE_QEI
 
 //*****************************************************************************
 //
@@ -58,10 +59,12 @@ extern uint32_t __STACK_TOP;
 //*****************************************************************************
 //extern void UARTIntHandler(void);
 //extern void Timer0IntHandler(void);
-extern void motor_interrupt_handler(void);
+extern void motor_s1_interrupt_handler(void);
+extern void motor_s2_interrupt_handler(void);
 extern void timer_interrupt_handler(void);
 extern void display_interrupt_handler(void);
 extern void warning_interrupt_handler(void);
+extern void bus_wait_interrupt_handler(void);
 
 //*****************************************************************************
 //
@@ -125,7 +128,7 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // GPIO Port H
     IntDefaultHandler,                      // UART2 Rx and Tx
     IntDefaultHandler,                      // SSI1 Rx and Tx
-    IntDefaultHandler,                      // Timer 3 subtimer A
+    bus_wait_interrupt_handler,             // Timer 3 subtimer A
     IntDefaultHandler,                      // Timer 3 subtimer B
     IntDefaultHandler,                      // I2C1 Master and Slave
     IntDefaultHandler,                      // CAN0
@@ -166,8 +169,13 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // GPIO Port N
     0,                                      // Reserved
     IntDefaultHandler,                      // Tamper
-    motor_interrupt_handler,                      // GPIO Port P (Summary or P0)
+#if USE_QEI
+    IntDefaultHandler,                      // GPIO Port P (Summary or P0), S1/S2 on QEI0
     IntDefaultHandler,                      // GPIO Port P1
+#else
+    motor_s1_interrupt_handler,             // GPIO Port P (Summary or P0), S1
+    motor_s2_interrupt_handler,             // GPIO Port P1, S2
+#endif
     IntDefaultHandler,                      // GPIO Port P2
     IntDefaultHandler,                      // GPIO Port P3
     IntDefaultHandler,                      // GPIO Port P4
@@ -0,0 +1,82 @@
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "widget.h"
+#include "cycles.h"
+
+/********************************************************************************/
+// Global Variables
+/********************************************************************************/
+static widget_t *first = 0;     // bottom of the z-order
+static widget_t *last = 0;
+static widget_t *resume = 0;    // widget whose draw() stopped early
+static widget_t *cursor = 0;    // next widget of the running pass
+static uint32_t slice_end = 0;  // cycles_now() deadline of the running slice
+static bool slice_limited = false;
+static uint32_t drawn = 0;      // widgets drawn in the running pass
+
+/********************************************************************************/
+void widget_add(widget_t *w){
+    w->next = 0;
+    w->elapsed_ms = 0;
+    w->dirty = true;            // first compositor pass draws it
+    if (last) last->next = w;
+    else first = w;
+    last = w;
+}
+
+void widget_invalidate(widget_t *w){
+    w->dirty = true;
+}
+
+void widgets_begin(uint32_t elapsed_ms){
+    widget_t *w;
+
+    for (w = first; w; w = w->next) {
+        uint32_t elapsed = w->elapsed_ms + elapsed_ms;
+        w->elapsed_ms = elapsed > 0xFFFF ? 0xFFFF : elapsed;
+        if (w->period_ms && w->elapsed_ms >= w->period_ms) w->dirty = true;
+    }
+    cursor = first;
+    drawn = 0;
+}
+
+bool widgets_expired(void){
+    return slice_limited && (int32_t)(cycles_now() - slice_end) >= 0;
+}
+
+bool widgets_step(void){
+    // unfinished widget first, it keeps its place in the z-order
+    if (resume) {
+        if (!resume->draw(resume)) return false;
+        resume = 0;
+        drawn++;
+    }
+    while (cursor) {
+        widget_t *w = cursor;
+        if (widgets_expired()) return false;
+        cursor = w->next;
+        if (!w->dirty) continue;
+
+        w->dirty = false;       // cleared first, draw() may invalidate again
+        w->elapsed_ms = 0;
+        if (!w->draw(w)) {
+            resume = w;
+            return false;
+        }
+        drawn++;
+    }
+    return true;
+}
+
+void widgets_slice(uint32_t budget_cycles){
+    slice_limited = budget_cycles != 0;
+    slice_end = cycles_now() + budget_cycles;
+}
+
+uint32_t widgets_compose(uint32_t elapsed_ms){
+    widgets_begin(elapsed_ms);
+    widgets_slice(0);
+    widgets_step();
+    return drawn;
+}
@@ -0,0 +1,31 @@
+#ifndef WIDGET_H_
+#define WIDGET_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Retained-mode widgets: every UI element has a dirty flag and its own refresh
+// period and always redraws as a whole. One compositor pass per display tick draws
+// the widgets that are dirty or due, in the order they were added (last added is on top).
+// A pass can be run in slices of a cycle budget: draw() returns false when it
+// stopped early (widgets_expired()) and is called again by the next slice.
+// After a sliced pass, call widgets_slice(0) so plain draw calls run to the end.
+
+typedef struct widget {
+    uint16_t period_ms;         // periodic redraw, 0: only when dirty
+    uint16_t elapsed_ms;        // time since the last draw
+    bool dirty;
+    bool (*draw)(struct widget *w);     // true: done, false: resume in the next slice
+    struct widget *next;
+} widget_t;
+
+void widget_add(widget_t *w);                   // registers and marks dirty
+void widget_invalidate(widget_t *w);
+
+void widgets_begin(uint32_t elapsed_ms);        // start a pass: due widgets become dirty
+void widgets_slice(uint32_t budget_cycles);     // start a slice, 0: no budget limit
+bool widgets_expired(void);                     // for draw(): slice budget used up
+bool widgets_step(void);                        // continue the pass, true once it is done
+uint32_t widgets_compose(uint32_t elapsed_ms);  // whole pass at once, returns number of widgets drawn
+
+#endif